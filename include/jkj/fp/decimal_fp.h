@@ -69,6 +69,23 @@ namespace jkj::fp {
 		bool			may_have_trailing_zeros;
 	};
 
+	// A pair of decimals enclosing an interval.
+	template <class DecimalFp>
+	struct decimal_interval {
+		DecimalFp		lower;
+		DecimalFp		upper;
+	};
+
+	// The class of the input reported by input_validation::classify.
+	enum class value_class : unsigned char { finite, zero, infinity, nan };
+
+	// A decimal_fp tagged with the class of the input. The significand and
+	// the exponent are zero unless the class is value_class::finite.
+	template <class DecimalFp>
+	struct classified_decimal_fp : DecimalFp {
+		value_class		classification;
+	};
+
 	template <class Float>
 	using unsigned_decimal_fp = decimal_fp<Float, false, false>;
 
@@ -19,6 +19,7 @@
 #define JKJ_HEADER_FP_DRAGONBOX_CACHE
 
 #include "../ieee754_format.h"
+#include "log.h"
 #include "wuint.h"
 #include <cstddef>
 
@@ -840,15 +841,79 @@ namespace jkj::fp {
 				}();
 
 				static constexpr std::uint32_t errors[] = {
-					0x50001400, 0x54044100, 0x54014555, 0x55954415, 0x54115555,
-					0x00000001, 0x50000000, 0x00104000, 0x54010004, 0x05004001,
-					0x55555544, 0x41545555, 0x54040551, 0x15445545, 0x51555514,
-					0x10000015, 0x00101100, 0x01100015, 0x00000000, 0x00000000,
-					0x00000000, 0x00000000, 0x04450514, 0x45414110, 0x55555145,
-					0x50544050, 0x15040155, 0x11054140, 0x50111514, 0x11451454,
-					0x00400541, 0x00000000, 0x55555450, 0x10056551, 0x10054011,
-					0x55551014, 0x69514555, 0x05151109, 0x00155555
+					0x15155440, 0x15051010, 0x45450501, 0x51454000, 0x44545545,
+					0x40100001, 0x44504101, 0x01055405, 0x96510050, 0x55555515,
+					0x45154145, 0x40145145, 0x50140155, 0x04004450, 0x00000000,
+					0x50405504, 0x04455455, 0x00000000, 0x00000000, 0x01011001,
+					0x01000050, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+					0x44555000, 0x54141101, 0x55551454, 0x04055505, 0x00001550,
+					0x00400400, 0x01111000, 0x14514540, 0x54155411, 0x55545455,
+					0x45550505, 0x50155515, 0x00100105, 0x50400141, 0x54145555,
+					0x51001556, 0x01155500
 				};
+				// Two bits per entry; regenerate the table whenever the range of k changes.
+				static_assert(sizeof(errors) / sizeof(errors[0]) * 16 >=
+					cache_holder<ieee754_format::binary64>::max_k -
+					cache_holder<ieee754_format::binary64>::min_k + 1);
+			};
+
+			// Defined in dragonbox.h; kappa is taken from there.
+			template <ieee754_format format>
+			struct impl_base;
+
+			// Cache entries Dragonbox uses for the numbers of the form d.ddd * 10^e with
+			// e in [min_decimal_exponent, max_decimal_exponent], copied into a table aligned
+			// to cache lines. kappa should be impl_base<format>::kappa.
+			template <ieee754_format format, int kappa,
+				int min_decimal_exponent, int max_decimal_exponent>
+			struct hot_range_cache_detail {
+				static_assert(min_decimal_exponent <= max_decimal_exponent);
+
+				using format_info = ieee754_format_info<format>;
+				using cache_entry_type = typename cache_holder<format>::cache_entry_type;
+
+				// The range of binary exponents of the significands with the implicit bit.
+				static constexpr int clamp_exponent(int e) noexcept {
+					constexpr int lower = format_info::min_exponent - format_info::significand_bits;
+					constexpr int upper = format_info::max_exponent - format_info::significand_bits;
+					return e < lower ? lower : e > upper ? upper : e;
+				}
+				static constexpr int min_exponent = clamp_exponent(
+					log::floor_log2_pow10(min_decimal_exponent) - format_info::significand_bits);
+				static constexpr int max_exponent = clamp_exponent(
+					log::floor_log2_pow10(max_decimal_exponent + 1) - format_info::significand_bits);
+
+				// k is decreasing in the exponent for each of the cases: the usual case,
+				// the closer boundary of the directed roundings, and the shorter interval case.
+				static constexpr int min_k = [] {
+					int k = kappa - log::floor_log10_pow2(max_exponent);
+					int const a = kappa - log::floor_log10_pow2(max_exponent - 1);
+					int const b = -log::floor_log10_pow2_minus_log10_4_over_3(max_exponent);
+					k = a < k ? a : k;
+					k = b < k ? b : k;
+					return k < cache_holder<format>::min_k ? cache_holder<format>::min_k : k;
+				}();
+				static constexpr int max_k = [] {
+					int k = kappa - log::floor_log10_pow2(min_exponent);
+					int const a = kappa - log::floor_log10_pow2(min_exponent - 1);
+					int const b = -log::floor_log10_pow2_minus_log10_4_over_3(min_exponent);
+					k = a > k ? a : k;
+					k = b > k ? b : k;
+					return k > cache_holder<format>::max_k ? cache_holder<format>::max_k : k;
+				}();
+				static constexpr std::size_t table_size = std::size_t(max_k - min_k + 1);
+
+				struct cache_holder_t {
+					alignas(64) cache_entry_type table[table_size];
+				};
+				static constexpr cache_holder_t cache = [] {
+					cache_holder_t res{};
+					for (std::size_t i = 0; i < table_size; ++i) {
+						res.table[i] = cache_holder<format>::cache[
+							std::size_t(min_k - cache_holder<format>::min_k) + i];
+					}
+					return res;
+				}();
 			};
 		}
 	}
@@ -0,0 +1,632 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#ifndef JKJ_HEADER_FP_DRAGONBOX_SHORTER_INTERVAL_TABLE
+#define JKJ_HEADER_FP_DRAGONBOX_SHORTER_INTERVAL_TABLE
+
+#include "../ieee754_format.h"
+#include <cstdint>
+
+namespace jkj::fp {
+	namespace detail {
+		namespace dragonbox {
+			// Results of the shorter interval case, indexed by the exponent bits minus 1.
+			// Each entry is the significand without trailing zeros, with the decimal exponent
+			// minus k stored from the bit exponent_offset_shift. Entries are zero for the
+			// exponents where the result depends on the interval type or the decimal rounding.
+			// Generated by subproject/meta/source/dragonbox_generate_shorter_interval_table.cpp.
+			template <ieee754_format format>
+			struct shorter_interval_table_holder;
+
+			template <>
+			struct shorter_interval_table_holder<ieee754_format::binary32> {
+				using entry_type = std::uint32_t;
+				static constexpr int exponent_offset_shift = 27;
+
+				static constexpr entry_type table[] = {
+					0x00b35dc0, 0x0166bb7f, 0x02cd76fe, 0x088f7e33,
+					0x081cb2d7, 0x083965ae, 0x0872cb5c, 0x00e596b8,
+					0x01cb2d6f, 0x085bd5e3, 0x00b7abc6, 0x016f578c,
+					0x084977e9, 0x100eb195, 0x1002f051, 0x1005e0a2,
+					0x100bc144, 0x08178288, 0x082f0510, 0x085e0a20,
+					0x00bc1440, 0x0178287f, 0x02f050ff, 0x05e0a1fd,
+					0x012ced33, 0x0259da65, 0x08785ee1, 0x00f0bdc2,
+					0x01e17b84, 0x03c2f708, 0x00c097cf, 0x082684c3,
+					0x1007b427, 0x100f684e, 0x081ed09c, 0x083da138,
+					0x087b4270, 0x00f684df, 0x01ed09bf, 0x03da137d,
+					0x00c53719, 0x018a6e32, 0x084ee2d7, 0x089dc5ae,
+					0x013b8b5b, 0x083f1bdf, 0x087e37be, 0x00fc6f7c,
+					0x01f8def9, 0x0864f965, 0x081431e1, 0x082863c2,
+					0x0850c784, 0x08a18f08, 0x01431e10, 0x02863c1f,
+					0x050c783f, 0x01027e73, 0x0204fce6, 0x0409f9cc,
+					0x00cecb8f, 0x019d971e, 0x0852b7d3, 0x08a56fa6,
+					0x014adf4b, 0x0295be97, 0x052b7d2e, 0x0108b2a3,
+					0x0834f087, 0x0869e10e, 0x00d3c21c, 0x01a78438,
+					0x0854b40b, 0x1010f0cf, 0x0821e19e, 0x0843c33c,
+					0x08878678, 0x010f0cf0, 0x021e19e1, 0x043c33c2,
+					0x00d8d727, 0x082b5e3b, 0x0856bc76, 0x00ad78ec,
+					0x015af1d8, 0x02b5e3af, 0x088ac723, 0x01158e46,
+					0x083782db, 0x086f05b6, 0x00de0b6b, 0x082c68af,
+					0x0858d15e, 0x00b1a2bc, 0x01634578, 0x08470de5,
+					0x088e1bca, 0x011c3793, 0x02386f27, 0x0871afd5,
+					0x00e35fa9, 0x01c6bf52, 0x038d7ea5, 0x00b5e621,
+					0x016bcc42, 0x02d79884, 0x089184e7, 0x012309ce,
+					0x0246139d, 0x048c2739, 0x00e8d4a5, 0x01d1a94a,
+					0x03a35294, 0x00ba43b7, 0x00000000, 0x02e90edd,
+					0x089502f9, 0x081dcd65, 0x1005f5e1, 0x1801312d,
+					0x18003d09, 0x20000c35, 0x28000271, 0x2800007d,
+					0x30000019, 0x38000005, 0x40000001, 0x38000002,
+					0x38000004, 0x38000008, 0x30000010, 0x30000020,
+					0x30000040, 0x28000080, 0x28000100, 0x28000200,
+					0x28000400, 0x20000800, 0x20001000, 0x20002000,
+					0x18004000, 0x18008000, 0x18010000, 0x10020000,
+					0x10040000, 0x10080000, 0x10100000, 0x08200000,
+					0x08400000, 0x00000000, 0x00000000, 0x00000000,
+					0x00000000, 0x00cccccd, 0x0199999a, 0x0851eb85,
+					0x08a3d70a, 0x0147ae14, 0x028f5c29, 0x0883126f,
+					0x081a36e3, 0x08346dc6, 0x0868db8c, 0x00d1b717,
+					0x0829f16b, 0x0853e2d6, 0x08a7c5ac, 0x014f8b59,
+					0x029f16b1, 0x088637bd, 0x010c6f7a, 0x0218def4,
+					0x0431bde8, 0x00d6bf95, 0x01ad7f2a, 0x035afe53,
+					0x00abcc77, 0x015798ee, 0x02af31dc, 0x0889705f,
+					0x0112e0bf, 0x0225c17d, 0x044b82fa, 0x00dbe6ff,
+					0x01b7cdfe, 0x036f9bfb, 0x00afebff, 0x08232f33,
+					0x08465e66, 0x088cbccc, 0x01197998, 0x08384b85,
+					0x0870970a, 0x00e12e13, 0x082d0937, 0x085a126e,
+					0x00b424dc, 0x016849b8, 0x02d09371, 0x08901d7d,
+					0x01203afa, 0x024075f4, 0x0480ebe8, 0x00e69595,
+					0x01cd2b29, 0x085c3bd5, 0x00b877aa, 0x0170ef54,
+					0x02e1dea9, 0x089392ef, 0x012725dd, 0x024e4bba,
+					0x049c9774, 0x00ec1e4b, 0x01d83c95, 0x03b0792a,
+					0x00bce509, 0x0179ca11, 0x02f39422, 0x05e72843,
+					0x012e3b41, 0x025c7681, 0x04b8ed03, 0x00f1c901,
+					0x01e39201, 0x0860b6cd, 0x00c16d9a, 0x0182db34,
+					0x0305b668, 0x089abe15, 0x081ef2d1, 0x083de5a2,
+					0x087bcb44, 0x00f79688, 0x01ef2d0f, 0x08630903,
+					0x00c61206, 0x018c240c, 0x084f3a69, 0x089e74d2,
+					0x013ce9a3, 0x0279d347, 0x087ec3db, 0x08195a5f,
+					0x10051213, 0x100a2426, 0x0814484c, 0x08289098,
+					0x08512130, 0x08a24260, 0x014484c0, 0x02890980,
+					0x0881ceb3, 0x01039d66
+				};
+			};
+
+			template <>
+			struct shorter_interval_table_holder<ieee754_format::binary64> {
+				using entry_type = std::uint64_t;
+				static constexpr int exponent_offset_shift = 59;
+
+				static constexpr entry_type table[] = {
+					0x004f0cedc95a718e, 0x080fcf62c1dee383, 0x001f9ec583bdc706, 0x003f3d8b077b8e0b,
+					0x007e7b160ef71c16, 0x00194bd136316c05, 0x08050f29d7a37c01, 0x080a1e53af46f802,
+					0x08143ca75e8df004, 0x0028794ebd1be007, 0x0050f29d7a37c00e, 0x00a1e53af46f801c,
+					0x0020610bca7cb339, 0x0040c21794f96672, 0x080cf39e50feae17, 0x0019e73ca1fd5c2e,
+					0x0033ce7943fab85b, 0x080a5c7ea73224df, 0x0814b8fd4e6449be, 0x002971fa9cc8937c,
+					0x0052e3f5399126f8, 0x00a5c7ea73224df0, 0x002127fbb0a075fd, 0x00424ff76140ebfa,
+					0x00849feec281d7f3, 0x001a8662f3b39197, 0x00350cc5e767232e, 0x006a198bcece465c,
+					0x0815384f295c7479, 0x002a709e52b8e8f2, 0x0054e13ca571d1e3, 0x0810f9d8ede39061,
+					0x0021f3b1dbc720c1, 0x0043e763b78e4183, 0x0087cec76f1c8305, 0x001b295b1638e701,
+					0x003652b62c71ce02, 0x006ca56c58e39c04, 0x0015baaf44fa5267, 0x080458897432107b,
+					0x0808b112e86420f6, 0x08116225d0c841ec, 0x0022c44ba19083d8, 0x00458897432107b1,
+					0x080de81e40a034bd, 0x0802c8060cecd759, 0x10008e679c2f5e45, 0x10011ccf385ebc8a,
+					0x0802399e70bd7914, 0x0804733ce17af228, 0x0808e679c2f5e450, 0x0811ccf385ebc8a0,
+					0x002399e70bd79140, 0x08071ec7cf2b1d0d, 0x080e3d8f9e563a1a, 0x001c7b1f3cac7433,
+					0x0038f63e7958e866, 0x0071ec7cf2b1d0cc, 0x0016c8e5ca239029, 0x002d91cb94472052,
+					0x005b2397288e40a4, 0x00b6472e511c8147, 0x002474a2dd05b375, 0x0048e945ba0b66e9,
+					0x0091d28b7416cdd2, 0x001d2a1be4048f91, 0x003a5437c8091f21, 0x080baa718e68396d,
+					0x001754e31cd072da, 0x002ea9c639a0e5b4, 0x08095527a5202df1, 0x0812aa4f4a405be2,
+					0x0025549e9480b7c3, 0x004aa93d29016f86, 0x0095527a5202df0d, 0x001ddd4baa009303,
+					0x0805f90f22001d67, 0x100131cfd3999f7b, 0x0802639fa7333ef6, 0x0804c73f4e667dec,
+					0x08098e7e9cccfbd8, 0x08131cfd3999f7b0, 0x002639fa7333ef5f, 0x0807a532170a6313,
+					0x080f4a642e14c626, 0x001e94c85c298c4c, 0x003d2990b8531899, 0x080c3b8358109e85,
+					0x00187706b0213d0a, 0x0030ee0d60427a14, 0x0061dc1ac084f428, 0x0813926bc01a973b,
+					0x0803ea158cd21e3f, 0x0807d42b19a43c7e, 0x080fa856334878fc, 0x001f50ac6690f1f8,
+					0x003ea158cd21e3f0, 0x007d42b19a43c7e1, 0x00190d56b873f4c7, 0x00321aad70e7e98d,
+					0x0064355ae1cfd31a, 0x08140aabc6c32a39, 0x002815578d865471, 0x08080444b5e7aa7d,
+					0x081008896bcf54fa, 0x00201112d79ea9f4, 0x00402225af3d53e8, 0x080cd3a1230c43fb,
+					0x0019a742461887f6, 0x00334e848c310fed, 0x00669d0918621fd9, 0x081485ce9e7a065f,
+					0x08041ac2ec7ece13, 0x08083585d8fd9c26, 0x08106b0bb1fb384c, 0x0020d61763f67097,
+					0x0041ac2ec7ece12f, 0x080d226fc195c6a3, 0x001a44df832b8d46, 0x003489bf06571a8c,
+					0x080a81f301449ee9, 0x081503e602893dd2, 0x002a07cc05127ba3, 0x00540f980a24f746,
+					0x0810cfeb353a97db, 0x00219fd66a752fb6, 0x00433facd4ea5f6b, 0x080d732290fbacaf,
+					0x001ae64521f7595e, 0x0035cc8a43eeb2bc, 0x006b991487dd6579, 0x001585041b2c477f,
+					0x002b0a0836588efd, 0x005614106cb11dfa, 0x081137367c236c65, 0x00226e6cf846d8ca,
+					0x0044dcd9f08db195, 0x0089b9b3e11b632a, 0x001b8b8a6038ad6f, 0x0805824ee00b55e3,
+					0x10011a0fc668aac7, 0x0802341f8cd1558e, 0x0804683f19a2ab1c, 0x0808d07e33455638,
+					0x0811a0fc668aac70, 0x002341f8cd1558e0, 0x004683f19a2ab1bf, 0x008d07e33455637f,
+					0x001c34c70a777a4d, 0x0038698e14eef499, 0x0070d31c29dde932, 0x0016909f3b92c83d,
+					0x002d213e7725907a, 0x005a427cee4b20f5, 0x08120d4c2fa8a031, 0x00241a985f514062,
+					0x00483530bea280c4, 0x080e7109bfba19c1, 0x001ce2137f743382, 0x0039c426fee86703,
+					0x0073884dfdd0ce06, 0x00171b42cc5cf601, 0x002e368598b9ec03, 0x005c6d0b3173d805,
+					0x00b8da1662e7b00a, 0x0024f86ae094bccf, 0x0049f0d5c129799e, 0x080ec9c459d51853,
+					0x0802f527452a9e77, 0x0805ea4e8a553cee, 0x080bd49d14aa79dc, 0x0017a93a2954f3b8,
+					0x002f527452a9e76f, 0x005ea4e8a553cede, 0x0812edc82110c2f9, 0x0025db90422185f3,
+					0x080792500d39e797, 0x100183a99c3ec7eb, 0x08030753387d8fd6, 0x08060ea670fb1fac,
+					0x080c1d4ce1f63f58, 0x00183a99c3ec7eb0, 0x0030753387d8fd5f, 0x0809b10a4e5e9913,
+					0x1001f03542dfb837, 0x0803e06a85bf706e, 0x0807c0d50b7ee0dc, 0x080f81aa16fdc1b8,
+					0x001f03542dfb8370, 0x003e06a85bf706e0, 0x080c67bb4597ce2d, 0x0018cf768b2f9c5a,
+					0x00319eed165f38b4, 0x00633dda2cbe7167, 0x0813d92ba28c7d15, 0x0027b2574518fa29,
+					0x004f64ae8a31f453, 0x009ec95d1463e8a5, 0x001fc1df6a7a61bb, 0x003f83bed4f4c375,
+					0x007f077da9e986ea, 0x001967e5eec84e2f, 0x080514c796280fa3, 0x080a298f2c501f46,
+					0x0814531e58a03e8c, 0x0028a63cb1407d18, 0x00514c796280fa30, 0x00a298f2c501f45f,
+					0x002084fd5a99fdad, 0x004109fab533fb59, 0x008213f56a67f6b3, 0x001a03fde214caf1,
+					0x003407fbc42995e1, 0x00680ff788532bc2, 0x0814cffe4e7708c1, 0x00299ffc9cee1181,
+					0x00533ff939dc2302, 0x0810a6650b926d67, 0x00214cca1724dacd, 0x004299942e49b59b,
+					0x008533285c936b36, 0x001aa3d4df50af0b, 0x080553f75fdcefcf, 0x080aa7eebfb9df9e,
+					0x08154fdd7f73bf3c, 0x002a9fbafee77e78, 0x00553f75fdcefcef, 0x08110cb132c2ff63,
+					0x002219626585fec6, 0x004432c4cb0bfd8c, 0x008865899617fb18, 0x001b4781ead1989f,
+					0x00368f03d5a3313d, 0x006d1e07ab46627a, 0x0015d2ce55747a19, 0x08045d5c777db205,
+					0x0808bab8eefb640a, 0x08117571ddf6c814, 0x0022eae3bbed9027, 0x0045d5c777db204e,
+					0x080df78e4b2bd343, 0x001bef1c9657a686, 0x0037de392caf4d0b, 0x006fbc72595e9a16,
+					0x001658e3ab795205, 0x002cb1c756f2a409, 0x0059638eade54812, 0x00b2c71d5bca9024,
+					0x0023c16c458ee9a1, 0x004782d88b1dd342, 0x008f05b1163ba683, 0x001c9abd04725481,
+					0x0039357a08e4a901, 0x080b7118682dbb67, 0x0016e230d05b76cd, 0x002dc461a0b6ed9b,
+					0x005b88c3416ddb35, 0x08124e8d737c5f0b, 0x00249d1ae6f8be15, 0x00493a35cdf17c2b,
+					0x0092746b9be2f855, 0x001d4a7bebfa31ab, 0x003a94f7d7f46355, 0x007529efafe8c6ab,
+					0x00176ec98994f489, 0x0804afc1e850fdb5, 0x08095f83d0a1fb6a, 0x0812bf07a143f6d4,
+					0x00257e0f4287eda7, 0x004afc1e850fdb4e, 0x0095f83d0a1fb69d, 0x001dfe729b9ff153,
+					0x0805ffb085866377, 0x080bff610b0cc6ee, 0x0017fec216198ddc, 0x002ffd842c331bb7,
+					0x005ffb085866376f, 0x08133234de7ad7e3, 0x00266469bcf5afc6, 0x0807adaebf64565b,
+					0x080f5b5d7ec8acb6, 0x001eb6bafd91596b, 0x003d6d75fb22b2d6, 0x080c491798a08a2b,
+					0x0018922f31411456, 0x0031245e628228ab, 0x006248bcc5045157, 0x00c491798a08a2ad,
+					0x0027504b8201ba23, 0x004ea09704037445, 0x009d412e0806e88b, 0x001f736f9b3494e9,
+					0x08064a498570ea95, 0x080c94930ae1d52a, 0x0019292615c3aa54, 0x0032524c2b8754a7,
+					0x0064a498570ea94e, 0x081420eb449c8843, 0x002841d689391086, 0x005083ad1272210c,
+					0x08101a55d07d39cf, 0x002034aba0fa739e, 0x0040695741f4e73c, 0x0080d2ae83e9ce79,
+					0x0019c3bc80c85c7f, 0x08052725b35b45b3, 0x080a4e4b66b68b66, 0x08149c96cd6d16cc,
+					0x0029392d9ada2d97, 0x0052725b35b45b2f, 0x08107d457124123d, 0x0020fa8ae2482479,
+					0x080698822d41a0e5, 0x080d31045a8341ca, 0x001a6208b5068394, 0x0034c4116a0d0728,
+					0x00698822d41a0e50, 0x08151b3a2a6b9c77, 0x080438a53baf1f4b, 0x1000d8210befd30f,
+					0x18002b39cf2ff703, 0x100056739e5fee06, 0x1000ace73cbfdc0c, 0x100159ce797fb818,
+					0x0802b39cf2ff7030, 0x08056739e5fee060, 0x080ace73cbfdc0c0, 0x00159ce797fb8180,
+					0x002b39cf2ff702ff, 0x0056739e5fee05fe, 0x08114a52dffc6799, 0x002294a5bff8cf32,
+					0x0045294b7ff19e65, 0x008a5296ffe33cc9, 0x001baa1e332d728f, 0x0805886c70a2b083,
+					0x10011b48e353bce7, 0x08023691c6a779ce, 0x08046d238d4ef39c, 0x0808da471a9de738,
+					0x0811b48e353bce70, 0x0023691c6a779ce0, 0x0046d238d4ef39bf, 0x080e2a0b5dc971f3,
+					0x001c5416bb92e3e6, 0x0038a82d7725c7cc, 0x0071505aee4b8f98, 0x0016a9abc9424feb,
+					0x002d535792849fd6, 0x005aa6af25093fad, 0x081221563a9b7323, 0x0803a044721f1707,
+					0x08074088e43e2e0e, 0x080e8111c87c5c1c, 0x001d022390f8b837, 0x003a044721f1706f,
+					0x080b9a74a0637ce3, 0x001734e940c6f9c6, 0x002e69d2818df38c, 0x0809485d4d1c63e9,
+					0x081290ba9a38c7d2, 0x0025217534718fa3, 0x004a42ea68e31f46, 0x080eda2ee1c70641,
+					0x001db45dc38e0c82, 0x003b68bb871c1905, 0x0076d1770e38320a, 0x0017c37e360b3d35,
+					0x002f86fc6c167a6a, 0x005f0df8d82cf4d4, 0x081302cb5e6f642b, 0x00260596bcdec855,
+					0x004c0b2d79bd90aa, 0x080f356f7ebf8355, 0x001e6adefd7f06aa, 0x0806155fcc4c9aef,
+					0x100137798f428563, 0x08026ef31e850ac6, 0x0804dde63d0a158c, 0x0809bbcc7a142b18,
+					0x08137798f4285630, 0x0026ef31e850ac5f, 0x0807c97061a9bc13, 0x080f92e0c3537826,
+					0x001f25c186a6f04c, 0x003e4b830d4de098, 0x080c75809c42c685, 0x08027de685a6f481,
+					0x0804fbcd0b4de902, 0x0809f79a169bd204, 0x0813ef342d37a408, 0x0027de685a6f4810,
+					0x004fbcd0b4de901f, 0x009f79a169bd203e, 0x001fe52048590673, 0x003fca4090b20ce6,
+					0x007f9481216419cb, 0x00198419d37a6b8f, 0x08051a6b90b21583, 0x080a34d721642b06,
+					0x081469ae42c8560c, 0x0028d35c8590ac18, 0x0051a6b90b215830, 0x00a34d721642b061,
+					0x0020a916d14089ad, 0x0041522da281135a, 0x0082a45b450226b4, 0x001a20df0dcd3af1,
+					0x003441be1b9a75e1, 0x080a738c6bebb12d, 0x0814e718d7d7625a, 0x0029ce31afaec4b4,
+					0x00539c635f5d8969, 0x0810b8e0acac4eaf, 0x002171c159589d5d, 0x0042e382b2b13aba,
+					0x0085c70565627574, 0x001ac1677aad4ab1, 0x003582cef55a9562, 0x080ab3c2fddeeaad,
+					0x080223f3cc5fc889, 0x080447e798bf9112, 0x08088fcf317f2224, 0x08111f9e62fe4448,
+					0x00223f3cc5fc8890, 0x00447e798bf91121, 0x080db2e51bfe9d07, 0x0802bd610599529b,
+					0x08057ac20b32a536, 0x080af58416654a6c, 0x0015eb082cca94d7, 0x002bd610599529af,
+					0x0057ac20b32a535d, 0x081188d357087713, 0x002311a6ae10ee25, 0x0046234d5c21dc4b,
+					0x008c469ab843b895, 0x001c0e1ef1a724eb, 0x00381c3de34e49d5, 0x0070387bc69c93ab,
+					0x001671b25aec1d89, 0x08047d23abc8d2b5, 0x0808fa475791a56a, 0x0811f48eaf234ad4,
+					0x0023e91d5e4695a7, 0x0047d23abc8d2b4f, 0x080e5d3ef282a243, 0x0802df72fd4d53a7,
+					0x0805bee5fa9aa74e, 0x080b7dcbf5354e9c, 0x0016fb97ea6a9d38, 0x002df72fd4d53a70,
+					0x0809316ff75dd87d, 0x1001d6affe45f819, 0x0803ad5ffc8bf032, 0x08075abff917e064,
+					0x080eb57ff22fc0c8, 0x001d6affe45f818f, 0x0805e2332dacb383, 0x080bc4665b596706,
+					0x001788ccb6b2ce0c, 0x002f11996d659c18, 0x005e2332dacb3831, 0x0812d3d6f88f0b3d,
+					0x0025a7adf11e167a, 0x004b4f5be23c2cf4, 0x080f0fdf2d3f3c31, 0x0803032ca2a63f3d,
+					0x08060659454c7e7a, 0x080c0cb28a98fcf4, 0x001819651531f9e8, 0x003032ca2a63f3cf,
+					0x0060659454c7e79e, 0x0813478410f4c7ed, 0x00268f0821e98fd9, 0x0807b634d3951cc5,
+					0x080f6c69a72a398a, 0x001ed8d34e547314, 0x003db1a69ca8e628, 0x007b634d3951cc50,
+					0x0018ad75d8438f43, 0x00315aebb0871e86, 0x0809defbf01b061b, 0x0813bdf7e0360c36,
+					0x00277befc06c186b, 0x004ef7df80d830d7, 0x080fcb2cb35e702b, 0x080328a28a46166f,
+					0x08065145148c2cde, 0x080ca28a291859bc, 0x001945145230b378, 0x00328a28a46166f0,
+					0x0065145148c2cde0, 0x00ca28a291859bc0, 0x00286e86e9e7858d, 0x0050dd0dd3cf0b19,
+					0x08102c35f729689f, 0x0020586bee52d13d, 0x0040b0d7dca5a27b, 0x080cf02b2c21207f,
+					0x0019e056584240fe, 0x0033c0acb08481fc, 0x080a59bc234db399, 0x0814b378469b6732,
+					0x002966f08d36ce63, 0x0052cde11a6d9cc6, 0x08108f936baf85c1, 0x00211f26d75f0b82,
+					0x00423e4daebe1705, 0x00847c9b5d7c2e0a, 0x001a7f5245e5a2cf, 0x0034fea48bcb459d,
+					0x080a99541bf57453, 0x081532a837eae8a6, 0x002a65506fd5d14b, 0x0054caa0dfaba296,
+					0x00a99541bf57452b, 0x0021eaa6bfde4109, 0x0806c887bff94035, 0x080d910f7ff2806a,
+					0x001b221effe500d4, 0x0036443dffca01a7, 0x080ada72ccc20055, 0x08022bb08f5a0011,
+					0x080457611eb40022, 0x0808aec23d680044, 0x08115d847ad00088, 0x0022bb08f5a0010f,
+					0x0806f234fdeccd03, 0x080de469fbd99a06, 0x001bc8d3f7b3340c, 0x003791a7ef666818,
+					0x006f234fdeccd030, 0x00163a432c8f5cd7, 0x002c7486591eb9ad, 0x0058e90cb23d735a,
+					0x00b1d219647ae6b3, 0x0023906b7a7efaf1, 0x08071ce24bb2fefd, 0x080e39c49765fdfa,
+					0x001c73892ecbfbf4, 0x0038e7125d97f7e7, 0x0071ce24bb2fefcf, 0x0016c2d4256ffcc3,
+					0x002d85a84adff986, 0x005b0b5095bff30c, 0x00b616a12b7fe618, 0x00246aed08b32e05,
+					0x0048d5da11665c09, 0x080e912b9d1478cf, 0x001d22573a28f19d, 0x003a44ae7451e33b,
+					0x0074895ce8a3c676, 0x00174eac2e8727b1, 0x0804a955a2e7d4bd, 0x080952ab45cfa97a,
+					0x0812a5568b9f52f4, 0x00254aad173ea5e8, 0x004a955a2e7d4bd0, 0x00952ab45cfa97a1,
+					0x001dd55745cbb7ed, 0x003baaae8b976fda, 0x0077555d172edfb4, 0x0017dddf6b095ff1,
+					0x002fbbbed612bfe2, 0x005f777dac257fc3, 0x081317e5ef3ab327, 0x00262fcbde75664e,
+					0x004c5f97bceacc9c, 0x080f46518c2ef5b9, 0x001e8ca3185deb72, 0x003d194630bbd6e3,
+					0x007a328c6177adc6, 0x0018708279e4bc5b, 0x0030e104f3c978b6, 0x0061c209e792f16c,
+					0x08138d352e5096af, 0x00271a6a5ca12d5e, 0x004e34d4b9425abc, 0x009c69a97284b579,
+					0x001f485516e7577f, 0x080641aa9e2e44b3, 0x080c83553c5c8966, 0x001906aa78b912cc,
+					0x00320d54f1722597, 0x080a02aa96b06deb, 0x081405552d60dbd6, 0x00280aaa5ac1b7ac,
+					0x00501554b5836f58, 0x00a02aa96b06deb1, 0x00200888489af957, 0x004011109135f2ad,
+					0x080cd03683713089, 0x0019a06d06e26112, 0x003340da0dc4c224, 0x006681b41b898448,
+					0x0814805738b51a75, 0x080419ab0b576bb1, 0x0808335616aed762, 0x081066ac2d5daec4,
+					0x0020cd585abb5d88, 0x00419ab0b576bb10, 0x008335616aed761f, 0x001a3de04895e46d,
+					0x00347bc0912bc8d9, 0x0068f781225791b2, 0x0814fe4d06de5057, 0x0029fc9a0dbca0ae,
+					0x0053f9341b79415c, 0x0810cb70d24b7379, 0x002196e1a496e6f1, 0x00432dc3492dcde3,
+					0x00865b86925b9bc6, 0x001adf1aea12525b, 0x08055fd22ed076df, 0x1001132a095ce493,
+					0x0802265412b9c926, 0x08044ca82573924c, 0x080899504ae72498, 0x081132a095ce4930,
+					0x002265412b9c9260, 0x0044ca82573924bf, 0x00899504ae72497f, 0x001b843422e3a84d,
+					0x0037086845c75099, 0x006e10d08b8ea132, 0x0016035ce8b6203d, 0x002c06b9d16c407a,
+					0x00580d73a2d880f5, 0x00b01ae745b101ea, 0x00233894a789cd2f, 0x08070b50ee4ec2a3,
+					0x080e16a1dc9d8546, 0x001c2d43b93b0a8c, 0x00385a8772761518, 0x0070b50ee4ec2a2f,
+					0x00168a9c942f3ba3, 0x002d1539285e7746, 0x005a2a7250bcee8c, 0x0812087d4358fc83,
+					0x002410fa86b1f905, 0x004821f50d63f20a, 0x080e6d3102ad96cf, 0x001cda62055b2d9e,
+					0x0039b4c40ab65b3b, 0x080b8a8d9bbe123f, 0x0017151b377c247e, 0x002e2a366ef848fc,
+					0x08093ba47c980e99, 0x1001d8ba7f519c85, 0x10005e8bb3105281, 0x1000bd176620a502,
+					0x10017a2ecc414a04, 0x0802f45d98829408, 0x0805e8bb31052810, 0x080bd176620a5020,
+					0x0017a2ecc414a040, 0x002f45d98829407f, 0x005e8bb3105280fe, 0x00bd176620a501fc,
+					0x0025d17ad3543399, 0x004ba2f5a6a86732, 0x080f209787bb47d7, 0x001e412f0f768fad,
+					0x003c825e1eed1f5b, 0x007904bc3dda3eb6, 0x00183425a5f872f1, 0x0030684b4bf0e5e2,
+					0x0060d09697e1cbc5, 0x08135ceaeb2d28c1, 0x0026b9d5d65a5182, 0x004d73abacb4a304,
+					0x009ae75759694607, 0x001efb1178484135, 0x003df622f0908269, 0x080c646d63501a15,
+					0x0018c8dac6a0342a, 0x003191b58d406854, 0x0063236b1a80d0a9, 0x00c646d63501a151,
+					0x0027a7c471005377, 0x004f4f88e200a6ed, 0x080fdcb4fa002163, 0x001fb969f40042c5,
+					0x003f72d3e800858b, 0x007ee5a7d0010b15, 0x001961219000356b, 0x0032c24320006ad5,
+					0x006584864000d5ab, 0x08144db473335def, 0x08040f8a7d70ac63, 0x1000cfe87f7cef47,
+					0x18002994e64c2fdb, 0x10005329cc985fb6, 0x1000a6539930bf6c, 0x10014ca732617ed8,
+					0x0802994e64c2fdb0, 0x0805329cc985fb60, 0x080a6539930bf6c0, 0x0814ca732617ed80,
+					0x002994e64c2fdb00, 0x005329cc985fb600, 0x00a6539930bf6bff, 0x002143eb702648cd,
+					0x004287d6e04c9199, 0x080d4e5e2cdc1d1f, 0x001a9cbc59b83a3d, 0x00353978b370747b,
+					0x080aa51823e34a7f, 0x08154a3047c694fe, 0x002a94608f8d29fc, 0x005528c11f1a53f7,
+					0x081108269fd210cb, 0x0022104d3fa42196, 0x0044209a7f48432c, 0x080da01ee641a709,
+					0x001b403dcc834e12, 0x0036807b99069c23, 0x080ae67f1e9aec07, 0x0015ccfe3d35d80e,
+					0x002b99fc7a6bb01c, 0x005733f8f4d76039, 0x081170cb642b133f, 0x0022e196c856267d,
+					0x0045c32d90ac4cfa, 0x008b865b215899f4, 0x001be7abd3781ecb, 0x0037cf57a6f03d95,
+					0x080b2977ee300c51, 0x08023b7e62d668dd, 0x080476fcc5acd1ba, 0x0808edf98b59a374,
+					0x0811dbf316b346e8, 0x0023b7e62d668dd0, 0x080724c7a2ae1c5d, 0x080e498f455c38ba,
+					0x001c931e8ab87173, 0x0805b7061bbe7d17, 0x080b6e0c377cfa2e, 0x0016dc186ef9f45c,
+					0x002db830ddf3e8b8, 0x005b7061bbe7d171, 0x081249ad2594c37d, 0x0024935a4b2986fa,
+					0x004926b496530df4, 0x080ea1575143cf97, 0x001d42aea2879f2e, 0x003a855d450f3e5d,
+					0x00750aba8a1e7cb9, 0x0017688bb5394c25, 0x002ed1176a72984a, 0x08095d04aee3b80f,
+					0x0812ba095dc7701e, 0x00257412bb8ee03b, 0x004ae825771dc076, 0x0095d04aee3b80ed,
+					0x001df67562d8b363, 0x003beceac5b166c5, 0x0077d9d58b62cd8a, 0x0017f85de8ad5c4f,
+					0x0804cb45fb55df43, 0x0809968bf6abbe86, 0x08132d17ed577d0c, 0x00265a2fdaaefa18,
+					0x004cb45fb55df430, 0x009968bf6abbe85f, 0x001eae8caef261ad, 0x080622e8efca1389,
+					0x080c45d1df942712, 0x00188ba3bf284e24, 0x003117477e509c47, 0x00622e8efca1388f,
+					0x0813a2e965b9d81d, 0x0803ed61e1252b39, 0x0807dac3c24a5672, 0x080fb5878494ace4,
+					0x001f6b0f092959c7, 0x003ed61e1252b38f, 0x007dac3c24a5671d, 0x001922726dbaae39,
+					0x003244e4db755c72, 0x006489c9b6eab8e4, 0x08141b8ebe2ef1c7, 0x08040582f2d6305b,
+					0x08080b05e5ac60b6, 0x0810160bcb58c16c, 0x00202c1796b182d8, 0x0040582f2d6305b1,
+					0x080cde6fd5e09abd, 0x080292e32ac68559, 0x080525c6558d0ab2, 0x080a4b8cab1a1564,
+					0x0814971956342ac8, 0x00292e32ac685590, 0x00525c6558d0ab20, 0x081078e111c3556d,
+					0x0020f1c22386aad9, 0x0041e384470d55b3, 0x0083c7088e1aab66, 0x001a5b01b605557b,
+					0x0034b6036c0aaaf6, 0x080a8acd7c022231, 0x0815159af8044462, 0x002a2b35f00888c4,
+					0x0054566be0111189, 0x00a8acd7c0222312, 0x0021bc2b266d3a37, 0x004378564cda746d,
+					0x0086f0ac99b4e8db, 0x001afcef51f0fb5f, 0x0035f9dea3e1f6be, 0x006bf3bd47c3ed7c,
+					0x00159725db272f7f, 0x002b2e4bb64e5efe, 0x00565c976c9cbdfd, 0x081145b7e285bf99,
+					0x00228b6fc50b7f32, 0x004516df8a16fe64, 0x008a2dbf142dfcc8, 0x001ba2bfd0d5ff5b,
+					0x0037457fa1abfeb6, 0x080b0de65388cc8b, 0x00161bcca7119916, 0x002c37994e23322b,
+					0x00586f329c466457, 0x00b0de65388cc8ae, 0x00235fadd81c2823, 0x0046bf5bb0385045,
+					0x080e264589a4dcdb, 0x001c4c8b1349b9b5, 0x003899162693736b, 0x0071322c4d26e6d6,
+					0x0016a3a275d49491, 0x002d4744eba92922, 0x005a8e89d7525244, 0x00b51d13aea4a489,
+					0x00243903efba874f, 0x08073e9a63254e43, 0x080e7d34c64a9c86, 0x001cfa698c95390c,
+					0x0039f4d3192a7217, 0x0073e9a63254e42f, 0x00172ebad6ddc73d, 0x0804a2f22af927d9,
+					0x1000ed63a231d4c5, 0x1001dac74463a98a, 0x0803b58e88c75314, 0x08076b1d118ea628,
+					0x080ed63a231d4c50, 0x001dac74463a989f, 0x003b58e88c75313f, 0x0076b1d118ea627e,
+					0x0017bd29d1c87a19, 0x002f7a53a390f432, 0x005ef4a74721e864, 0x0812fdbb0e39fb47,
+					0x0025fb761c73f68f, 0x004bf6ec38e7ed1d, 0x080f316271c7fc39, 0x001e62c4e38ff872,
+					0x003cc589c71ff0e4, 0x00798b138e3fe1c8, 0x00184f03e93ff9f5, 0x00309e07d27ff3ea,
+					0x00613c0fa4ffe7d3, 0x0813726987666191, 0x0026e4d30eccc321, 0x004dc9a61d998643,
+					0x009b934c3b330c85, 0x001f1d75a5709c1b, 0x003e3aeb4ae13835, 0x080c722f0ef9d80b,
+					0x0018e45e1df3b015, 0x0804fa793930bcd1, 0x0809f4f2726179a2, 0x0813e9e4e4c2f344,
+					0x0027d3c9c985e689, 0x004fa793930bcd11, 0x080fee50b7025c37, 0x08032fa9be33ac0b,
+					0x08065f537c675816, 0x080cbea6f8ceb02c, 0x00197d4df19d6058, 0x0032fa9be33ac0af,
+					0x0065f537c675815e, 0x0814643e5ae44d13, 0x0028c87cb5c89a25, 0x005190f96b91344b,
+					0x08105031e2503da9, 0x0020a063c4a07b51, 0x004140c78940f6a2, 0x0082818f1281ed45,
+					0x001a19e96a19fc41, 0x003433d2d433f882, 0x080a70c3c40a64e7, 0x0814e1878814c9ce,
+					0x0029c30f1029939b, 0x08085a36366eb71f, 0x1001aba4714957d3, 0x1000558749db77f7,
+					0x1000ab0e93b6efee, 0x1001561d276ddfdc, 0x0802ac3a4edbbfb8, 0x080558749db77f70,
+					0x080ab0e93b6efee0, 0x001561d276ddfdc0, 0x002ac3a4edbbfb80, 0x08088d8762bf324d,
+					0x1001b5e7e08ca3a9, 0x08036bcfc1194752, 0x0806d79f82328ea4, 0x080daf3f04651d48,
+					0x001b5e7e08ca3a8f, 0x0036bcfc1194751f, 0x006d79f82328ea3e, 0x0015e531a0a1c873,
+					0x08046109eced2817, 0x0808c213d9da502e, 0x08118427b3b4a05c, 0x0023084f676940b8,
+					0x0046109eced2816f, 0x080e0352f62a19e3, 0x001c06a5ec5433c6, 0x00380d4bd8a8678c,
+					0x00701a97b150cf18, 0x00166bb7f0435c9f, 0x08047bf19673df53, 0x0808f7e32ce7bea6,
+					0x0811efc659cf7d4c, 0x0023df8cb39efa97, 0x0047bf19673df52e, 0x008f7e32ce7bea5c,
+					0x001cb2d6f618c879, 0x003965adec3190f2, 0x0072cb5bd86321e4, 0x0016f578c4e0a061,
+					0x002deaf189c140c1, 0x005bd5e313828183, 0x08125dfa371a19e7, 0x0024bbf46e3433ce,
+					0x004977e8dc68679c, 0x0092efd1b8d0cf38, 0x001d6329f1c35ca5, 0x003ac653e386b949,
+					0x080bc143fa4e250f, 0x00178287f49c4a1e, 0x002f050fe938943b, 0x005e0a1fd2712876,
+					0x0812ced32a16a1b1, 0x00259da6542d4362, 0x080785ee10d5da47, 0x080f0bdc21abb48e,
+					0x001e17b84357691b, 0x003c2f7086aed237, 0x00785ee10d5da46e, 0x001812f9cf7920e3,
+					0x003025f39ef241c5, 0x0809a130b963a6c1, 0x0813426172c74d82, 0x002684c2e58e9b04,
+					0x0807b426fab61f01, 0x080f684df56c3e02, 0x001ed09bead87c03, 0x080629b8c891b267,
+					0x080c5371912364ce, 0x0018a6e32246c99c, 0x00314dc6448d9339, 0x00629b8c891b2672,
+					0x0813b8b5b5056e17, 0x0027716b6a0adc2d, 0x0807e37be2022c09, 0x080fc6f7c4045812,
+					0x001f8def8808b024, 0x003f1bdf10116049, 0x080c9f2c9cd04675, 0x00193e5939a08cea,
+					0x00327cb2734119d4, 0x080a18f07d736b91, 0x081431e0fae6d722, 0x002863c1f5cdae43,
+					0x0050c783eb9b5c86, 0x081027e72f1f1281, 0x00204fce5e3e2502, 0x00409f9cbc7c4a05,
+					0x080cecb8f27f4201, 0x0019d971e4fe8402, 0x0033b2e3c9fd0804, 0x006765c793fa1008,
+					0x0814adf4b7320335, 0x00295be96e640669, 0x0052b7d2dcc80cd3, 0x08108b2a2c280291,
+					0x0021165458500521, 0x08069e10de76676d, 0x080d3c21bcecceda, 0x001a784379d99db4,
+					0x0034f086f3b33b68, 0x0000000000000000, 0x08152d02c7e14af7, 0x002a5a058fc295ed,
+					0x080878678326eac9, 0x1001b1ae4d6e2ef5, 0x100056bc75e2d631, 0x18001158e460913d,
+					0x200003782dace9d9, 0x200000b1a2bc2ec5, 0x2800002386f26fc1, 0x300000071afd498d,
+					0x300000016bcc41e9, 0x3800000048c27395, 0x400000000e8d4a51, 0x4800000002e90edd,
+					0x48000000009502f9, 0x50000000001dcd65, 0x580000000005f5e1, 0x580000000001312d,
+					0x6000000000003d09, 0x6800000000000c35, 0x6800000000000271, 0x700000000000007d,
+					0x7800000000000019, 0x8000000000000005, 0x8000000000000001, 0x8000000000000002,
+					0x8000000000000004, 0x7800000000000008, 0x7800000000000010, 0x7800000000000020,
+					0x7000000000000040, 0x7000000000000080, 0x7000000000000100, 0x7000000000000200,
+					0x6800000000000400, 0x6800000000000800, 0x6800000000001000, 0x6000000000002000,
+					0x6000000000004000, 0x6000000000008000, 0x5800000000010000, 0x5800000000020000,
+					0x5800000000040000, 0x5800000000080000, 0x5000000000100000, 0x5000000000200000,
+					0x5000000000400000, 0x4800000000800000, 0x4800000001000000, 0x4800000002000000,
+					0x4000000004000000, 0x4000000008000000, 0x4000000010000000, 0x4000000020000000,
+					0x3800000040000000, 0x3800000080000000, 0x3800000100000000, 0x3000000200000000,
+					0x3000000400000000, 0x3000000800000000, 0x2800001000000000, 0x2800002000000000,
+					0x2800004000000000, 0x2800008000000000, 0x2000010000000000, 0x2000020000000000,
+					0x2000040000000000, 0x1800080000000000, 0x1800100000000000, 0x1800200000000000,
+					0x1000400000000000, 0x1000800000000000, 0x1001000000000000, 0x1002000000000000,
+					0x0804000000000000, 0x0808000000000000, 0x0000000000000000, 0x0000000000000000,
+					0x0000000000000000, 0x0000000000000000, 0x001999999999999a, 0x0033333333333333,
+					0x0066666666666666, 0x08147ae147ae147b, 0x0804189374bc6a7f, 0x08083126e978d4fe,
+					0x0810624dd2f1a9fc, 0x0020c49ba5e353f8, 0x004189374bc6a7f0, 0x0083126e978d4fdf,
+					0x001a36e2eb1c432d, 0x00346dc5d6388659, 0x0068db8bac710cb3, 0x0814f8b588e368f1,
+					0x0029f16b11c6d1e1, 0x0053e2d6238da3c2, 0x0810c6f7a0b5ed8d, 0x08035afe535795e9,
+					0x0806b5fca6af2bd2, 0x080d6bf94d5e57a4, 0x001ad7f29abcaf48, 0x0035afe535795e91,
+					0x080abcc77118461d, 0x0015798ee2308c3a, 0x002af31dc4611874, 0x0055e63b88c230e7,
+					0x08112e0be826d695, 0x00225c17d04dad29, 0x0044b82fa09b5a53, 0x0089705f4136b4a6,
+					0x001b7cdfd9d7bdbb, 0x0036f9bfb3af7b75, 0x080afebff0bcb24b, 0x0015fd7fe1796496,
+					0x002bfaffc2f2c92b, 0x0057f5ff85e59255, 0x08119799812dea11, 0x00232f33025bd422,
+					0x00465e6604b7a844, 0x080e12e13424bb41, 0x001c25c268497682, 0x00384b84d092ed04,
+					0x00709709a125da07, 0x0016849b86a12b9b, 0x002d09370d425736, 0x080901d7cf73ab0b,
+					0x081203af9ee75616, 0x0024075f3dceac2b, 0x080734aca5f6226f, 0x080e69594bec44de,
+					0x001cd2b297d889bc, 0x0039a5652fb11378, 0x00734aca5f6226f1, 0x00170ef54646d497,
+					0x08049c97747490eb, 0x0809392ee8e921d6, 0x0812725dd1d243ac, 0x0024e4bba3a48757,
+					0x080760f253edb4ab, 0x080ec1e4a7db6956, 0x001d83c94fb6d2ac, 0x0805e72843249089,
+					0x10012e3b40a0e9b5, 0x08025c768141d36a, 0x0804b8ed0283a6d4, 0x080971da05074da8,
+					0x0812e3b40a0e9b50, 0x0025c768141d369f, 0x004b8ed0283a6d3e, 0x080f1c90080baf73,
+					0x001e392010175ee6, 0x003c7240202ebdcb, 0x080c16d9a0095929, 0x08026af8533511d5,
+					0x0804d5f0a66a23aa, 0x0809abe14cd44754, 0x081357c299a88ea8, 0x0026af8533511d4f,
+					0x004d5f0a66a23a9e, 0x009abe14cd44753b, 0x001ef2d0f5da7dd9, 0x08063090312bb2c5,
+					0x10013ce9a36f23c1, 0x080279d346de4782, 0x0804f3a68dbc8f04, 0x0809e74d1b791e08,
+					0x0813ce9a36f23c10, 0x00279d346de47820, 0x004f3a68dbc8f03f, 0x080fd87b5f28300d,
+					0x08032b4bdfd4d669, 0x1000a2425ff75e15, 0x18002073accb12d1, 0x100040e7599625a2,
+					0x100081ceb32c4b44, 0x1001039d66589688, 0x1002073accb12d10, 0x08040e7599625a20,
+					0x08081ceb32c4b440, 0x081039d665896880, 0x002073accb12d0ff, 0x0040e7599625a1fe,
+					0x0081ceb32c4b43fd, 0x0019f623d5a8a733, 0x0805313a5dee87d7, 0x080a6274bbdd0fae,
+					0x0814c4e977ba1f5c, 0x002989d2ef743eb7, 0x005313a5dee87d6f, 0x00a6274bbdd0fadd,
+					0x00213b0f25f69893, 0x0042761e4bed3125, 0x0084ec3c97da624b, 0x001a95a5b7f87a0f,
+					0x00352b4b6ff0f41e, 0x006a5696dfe1e83c, 0x08154484932d2e73, 0x002a8909265a5ce5,
+					0x005512124cb4b9c9, 0x0811039d428a8b8f, 0x0022073a8515171d, 0x0806ce3ee76a9e39,
+					0x080d9c7dced53c72, 0x001b38fb9daa78e4, 0x080571cbec554b61, 0x080ae397d8aa96c2,
+					0x0015c72fb1552d84, 0x002b8e5f62aa5b07, 0x00571cbec554b60e, 0x00ae397d8aa96c1b,
+					0x0022d84c4eeeaf39, 0x0045b0989ddd5e71, 0x008b61313bbabce3, 0x001be03d0bf225c7,
+					0x0037c07a17e44b8e, 0x006f80f42fc8971c, 0x00164cfda3281e39, 0x002c99fb46503c72,
+					0x005933f68ca078e3, 0x0811d7314f534b61, 0x080391704310a8ad, 0x080722e08621515a,
+					0x080e45c10c42a2b4, 0x001c8b8218854567, 0x00391704310a8acf, 0x00722e086215159e,
+					0x0016d601ad376ab9, 0x002dac035a6ed572, 0x005b5806b4ddaae4, 0x081244ce242c5561,
+					0x0024899c4858aac2, 0x0049133890b15584, 0x080e9d71b689dde7, 0x0802ec49f14ec5fb,
+					0x0805d893e29d8bf6, 0x080bb127c53b17ec, 0x0017624f8a762fd8, 0x002ec49f14ec5fb0,
+					0x005d893e29d8bf61, 0x00bb127c53b17ec1, 0x00256a18dd89e627, 0x004ad431bb13cc4d,
+					0x0095a8637627989b, 0x001dee7a4ad4b81f, 0x0805fc7edbc424d3, 0x1001327fc58da0f7,
+					0x080264ff8b1b41ee, 0x0804c9ff163683dc, 0x080993fe2c6d07b8, 0x081327fc58da0f70,
+					0x00264ff8b1b41ee0, 0x004c9ff163683dc0, 0x00993fe2c6d07b80, 0x001ea6608e29b24d,
+					0x0806214682d523a9, 0x080c428d05aa4752, 0x0018851a0b548ea4, 0x00310a3416a91d48,
+					0x006214682d523a8f, 0x08139dae6f76d883, 0x00273b5cdeedb106, 0x004e76b9bddb620c,
+					0x080fb158592be069, 0x001f62b0b257c0d2, 0x003ec56164af81a3, 0x080c8de047564d21,
+					0x00191bc08eac9a41, 0x003237811d593483, 0x080a0b19d2ab70e7, 0x100202385d557cfb,
+					0x08040470baaaf9f6, 0x080808e17555f3ec, 0x081011c2eaabe7d8, 0x00202385d557cfb0,
+					0x0040470baaaf9f60, 0x080cdb0255565313, 0x0019b604aaaca626, 0x00336c0955594c4c,
+					0x080a48ceaaab75a9, 0x10020e8fbbbbe455, 0x08041d1f7777c8aa, 0x08083a3eeeef9154,
+					0x0810747ddddf22a8, 0x0020e8fbbbbe4550, 0x0041d1f7777c8a9f, 0x0083a3eeeef9153f,
+					0x001a53fc9631d10d, 0x0034a7f92c63a219, 0x00694ff258c74432, 0x08150ffd44f4a73d,
+					0x002a1ffa89e94e7a, 0x00543ff513d29cf5, 0x00a87fea27a539ea, 0x0021b32ed4baa52f,
+					0x0043665da9754a5d, 0x080d7adf884aa879, 0x001af5bf109550f2, 0x0805645969b77697,
+					0x080ac8b2d36eed2e, 0x00159165a6ddda5c, 0x002b22cb4dbbb4b7, 0x005645969b77696d,
+					0x0811411e1f17e1e3, 0x0022823c3e2fc3c5, 0x0806e6d8d93cc0c1, 0x080dcdb1b2798182,
+					0x001b9b6364f30304, 0x003736c6c9e60609, 0x006e6d8d93cc0c11, 0x001615e91d8f359d,
+					0x002c2bd23b1e6b3a, 0x005857a4763cd674, 0x00b0af48ec79ace8, 0x00235641c8e52295,
+					0x0046ac8391ca452a, 0x080e2280b6c20dd5, 0x001c45016d841baa, 0x00388a02db083755,
+					0x00711405b6106ea9, 0x00169d9abe034955, 0x002d3b357c0692aa, 0x005a766af80d2554,
+					0x081217aefe690777, 0x08039e5632e1ce4b, 0x08073cac65c39c96, 0x080e7958cb87392c,
+					0x001cf2b1970e7258, 0x0805ca23849c7d45, 0x080b94470938fa8a, 0x0017288e1271f514,
+					0x002e511c24e3ea27, 0x005ca23849c7d44e, 0x00b94470938fa89c, 0x00250db01d8321b9,
+					0x004a1b603b064372, 0x009436c0760c86e3, 0x001da48ce468e7c7, 0x0805edb5c7482e5b,
+					0x080bdb6b8e905cb6, 0x0017b6d71d20b96c, 0x002f6dae3a4172d8, 0x005edb5c7482e5b0,
+					0x0812f8ac174d6123, 0x0803cb559e42ad07, 0x1000c24452da229b, 0x10018488a5b44536,
+					0x080309114b688a6c, 0x0806122296d114d8, 0x080c24452da229b0, 0x0018488a5b445360,
+					0x00309114b688a6c1, 0x0809b69dbe1b548d, 0x1001f152bf9f10e9, 0x0803e2a57f3e21d2,
+					0x0807c54afe7c43a4, 0x080f8a95fcf88748, 0x001f152bf9f10e90, 0x003e2a57f3e21d1f,
+					0x080c6ede63fa05d3, 0x0018ddbcc7f40ba6, 0x0031bb798fe8174c, 0x006376f31fd02e99,
+					0x0813e497065cd61f, 0x0027c92e0cb9ac3d, 0x004f925c1973587a, 0x009f24b832e6b0f4,
+					0x001fd424d6faf031, 0x003fa849adf5e062, 0x080cbb41ef979347, 0x00197683df2f268e,
+					0x0032ed07be5e4d1b, 0x0065da0f7cbc9a36, 0x08145ecfe5bf520b, 0x0028bd9fcb7ea416,
+					0x00517b3f96fd482b, 0x08104bd984990e6f, 0x002097b309321cde, 0x00412f66126439bc,
+					0x00825ecc24c87378, 0x001a12f5a0f4e3e5, 0x003425eb41e9c7ca, 0x00684bd683d38f93,
+					0x0814dbf7b3f71cb7, 0x0029b7ef67ee396e, 0x00536fdecfdc72dc, 0x00a6dfbd9fb8e5b9,
+					0x00215ff2b98b6125, 0x0042bfe57316c24a, 0x080d59944a37c075, 0x001ab328946f80ea,
+					0x0035665128df01d5, 0x006acca251be03a9, 0x00155c2076bf9a55, 0x002ab840ed7f34aa,
+					0x00557081dafe6954, 0x00aae103b5fcd2a9, 0x00222d00bdff5d55, 0x00445a017bfebaaa,
+					0x0088b402f7fd7554, 0x001b5733cb32b111, 0x0036ae6796656221, 0x080aefae51477a07,
+					0x0015df5ca28ef40e, 0x002bbeb9451de81b, 0x0808bfbea76c619f, 0x1001bff2ee48e053,
+					0x08037fe5dc91c0a6, 0x0806ffcbb923814c, 0x080dff9772470298, 0x001bff2ee48e0530,
+					0x0037fe5dc91c0a60, 0x006ffcbb923814bf, 0x001665bf1d3e6a8d, 0x002ccb7e3a7cd519,
+					0x005996fc74f9aa33, 0x00b32df8e9f35465, 0x0023d5fe9530aa7b, 0x0047abfd2a6154f5,
+					0x080e55990879ddcb, 0x0802ddeb68185f8f, 0x0805bbd6d030bf1e, 0x080b77ada0617e3c,
+					0x0016ef5b40c2fc78, 0x002ddeb68185f8ef, 0x005bbd6d030bf1de, 0x08125915cd68c9f9,
+					0x0024b22b9ad193f2, 0x080756d5855d1d97, 0x080eadab0aba3b2e, 0x001d5b561574765c,
+					0x003ab6ac2ae8ecb7, 0x080bbe226efb628b, 0x00177c44ddf6c516, 0x002ef889bbed8a2c,
+					0x005df11377db1458, 0x0812c9d0b1923745, 0x002593a163246e8a, 0x004b2742c648dd13,
+					0x080f07da27a82c37, 0x001e0fb44f50586e, 0x003c1f689ea0b0dc, 0x080c06481fb9bcf9,
+					0x00180c903f7379f2, 0x003019207ee6f3e3, 0x00603240fdcde7c7, 0x08133d4032c2c7f5,
+					0x00267a8065858fe9, 0x004cf500cb0b1fd2, 0x080f64335bcf065d, 0x001ec866b79e0cba,
+					0x003d90cd6f3c1975, 0x007b219ade7832ea, 0x0018a0522c7e7095, 0x003140a458fce12a,
+					0x0809d9ba7832936f, 0x1001f8587e7083e3, 0x0803f0b0fce107c6, 0x0807e161f9c20f8c,
+					0x080fc2c3f3841f18, 0x001f8587e7083e30, 0x003f0b0fce107c5f, 0x080c9bcff6034c13,
+					0x0019379fec069826, 0x00326f3fd80d304c, 0x0064de7fb01a6098, 0x08142c7ff0054685,
+					0x002858ffe00a8d0a, 0x0050b1ffc0151a13, 0x081023998cd10537, 0x0020473319a20a6e,
+					0x00408e66334414dc, 0x00811ccc668829b9, 0x0019d28f47b4d525, 0x0033a51e8f69aa4a,
+					0x00674a3d1ed35494, 0x0814a8729fc3ddb7, 0x080421b0865a5f8b, 0x080843610cb4bf16,
+					0x081086c219697e2c, 0x00210d8432d2fc58, 0x00421b0865a5f8b0, 0x00843610cb4bf161,
+					0x001a71368f0f3047, 0x080549d7b6363cdb, 0x080a93af6c6c79b6, 0x0815275ed8d8f36c,
+					0x002a4ebdb1b1e6d7, 0x00549d7b6363cdaf, 0x00a93af6c6c79b5d, 0x0021d897c15b1f13,
+					0x0043b12f82b63e25, 0x0087625f056c7c4b, 0x001b13ac9aaf4c0f, 0x00362759355e981e,
+					0x080ad4ab7112eb39, 0x0015a956e225d672, 0x002b52adc44bace5, 0x0808aa22c0dbef61,
+					0x0811544581b7dec2, 0x0022a88b036fbd84, 0x0045511606df7b07, 0x008aa22c0dbef60f,
+					0x001bba08cf8c979d, 0x003774119f192f39, 0x006ee8233e325e72, 0x00162e6d72d6dfb1,
+					0x08046faf7d5e2cbd, 0x0808df5efabc597a, 0x0811bebdf578b2f4, 0x00237d7beaf165e7,
+					0x08071918c896adfb, 0x10016b6b5b5155ff, 0x0802d6d6b6a2abfe, 0x0805adad6d4557fc,
+					0x080b5b5ada8aaff8, 0x0016b6b5b5155ff0, 0x002d6d6b6a2abfe0, 0x080915e2486ef32d,
+					0x08122bc490dde65a, 0x0024578921bbccb3, 0x0048af1243779967, 0x00915e2486ef32cd,
+					0x001d12d41afca3c3, 0x0805d090d2328727, 0x080ba121a4650e4e, 0x0017424348ca1c9c,
+					0x002e848691943937, 0x005d090d2328726f, 0x08129b69070816e3, 0x002536d20e102dc6,
+					0x0807715d36033c5b, 0x080ee2ba6c0678b6, 0x001dc574d80cf16b, 0x003b8ae9b019e2d6,
+					0x007715d36033c5ad, 0x0017d12a4670c123, 0x002fa2548ce18245, 0x005f44a919c3048a,
+					0x08130dbb6b8d674f, 0x00261b76d71ace9e, 0x004c36edae359d3b, 0x080f3e2f893dec3f,
+					0x001e7c5f127bd87e, 0x003cf8be24f7b0fc, 0x080c31bfa0fe5699, 0x0802705986994485,
+					0x0804e0b30d32890a, 0x0809c1661a651214, 0x081382cc34ca2428, 0x0027059869944850,
+					0x0807cdeb4850db43, 0x10018f9574dcf8a7, 0x08031f2ae9b9f14e, 0x08063e55d373e29c,
+					0x080c7caba6e7c538, 0x0018f9574dcf8a70, 0x0804feab0f8fe87d, 0x0809fd561f1fd0fa,
+					0x0813faac3e3fa1f4, 0x0027f5587c7f43e7, 0x004feab0f8fe87ce, 0x009fd561f1fd0f9c,
+					0x001ff779fd329cb9, 0x003feef3fa653972, 0x080cc963fee10b7d, 0x001992c7fdc216fa,
+					0x08051d5b32c06aff, 0x080a3ab66580d5fe, 0x0814756ccb01abfc, 0x0028ead9960357f7,
+					0x0051d5b32c06afed, 0x08105df0a267bcc9, 0x0020bbe144cf7992, 0x004177c2899ef324,
+					0x0082ef85133de649, 0x001a2fe76a3f9475, 0x00345fced47f28ea, 0x0068bf9da8fe51d4,
+					0x0814f31f8832dd2b, 0x0029e63f1065ba55, 0x0053cc7e20cb74a9, 0x0810c27fa028b0ef,
+					0x002184ff405161dd, 0x004309fe80a2c3bb, 0x008613fd01458776, 0x001ad0cc33744e4b,
+					0x0035a19866e89c95, 0x080ab9eb47c81f51, 0x001573d68f903ea2, 0x002ae7ad1f207d44,
+					0x0055cf5a3e40fa89, 0x0811297872d9cbb5, 0x002252f0e5b3976a, 0x0044a5e1cb672ed4,
+					0x00894bc396ce5da7, 0x001b758d848fac55, 0x0036eb1b091f58a9, 0x080afbd2350644ef,
+					0x0015f7a46a0c89de, 0x002bef48d41913bb, 0x0057de91a8322775, 0x081192e9ee706e4b,
+					0x002325d3dce0dc95, 0x00464ba7b9c1b92b, 0x008c974f73837255, 0x001c1e43171a4a11,
+					0x08059fa7049edb9d, 0x080b3f4e093db73a, 0x00167e9c127b6e74, 0x002cfd3824f6dce8,
+					0x0059fa7049edb9d0, 0x0811fee341fc585d, 0x0023fdc683f8b0ba, 0x0047fb8d07f16173,
+					0x080e65829b3046b1, 0x0802e11a1f09a7bd, 0x0805c2343e134f7a, 0x080b84687c269ef4,
+					0x001708d0f84d3de8, 0x002e11a1f09a7bcf, 0x005c2343e134f79e, 0x08126d73f9d764b9,
+					0x0024dae7f3aec972, 0x0049b5cfe75d92e5, 0x080ebdf661791d61, 0x001d7becc2f23ac2,
+					0x003af7d985e47584, 0x0075efb30bc8eb08, 0x00179657025b6235, 0x002f2cae04b6c469,
+					0x005e595c096d88d3, 0x0812deac01e2b4f7, 0x0025bd5803c569ee, 0x004b7ab0078ad3dc,
+					0x080f18899b1bc3f9, 0x001e3113363787f2, 0x003c62266c6f0fe3, 0x0078c44cd8de1fc6,
+					0x0018274291c6065b, 0x00304e85238c0cb6, 0x00609d0a4718196b, 0x0813529ba7d19eaf,
+					0x0803dd5254c38623, 0x0807baa4a9870c46, 0x080f7549530e188c, 0x001eea92a61c3118,
+					0x003dd5254c386230, 0x080c5dd44271ad3d, 0x0802792a73b055d9, 0x0804f254e760abb2,
+					0x0809e4a9cec15764, 0x0813c9539d82aec8, 0x002792a73b055d90, 0x004f254e760abb1f,
+					0x080fd442e4688bd3, 0x08032a73c7481bf7, 0x1000a21727db38cb, 0x1001442e4fb67196,
+					0x0802885c9f6ce32c, 0x080510b93ed9c658, 0x080a21727db38cb0, 0x081442e4fb671960,
+					0x002885c9f6ce32c0, 0x00510b93ed9c6580, 0x08103583fc527ab3, 0x08033de73276e557,
+					0x08067bce64edcaae, 0x080cf79cc9db955c, 0x0019ef3993b72ab8, 0x0033de73276e5571,
+					0x080a5fb0a17c777d, 0x10021323537f4b19, 0x08042646a6fe9632, 0x08084c8d4dfd2c64,
+					0x0810991a9bfa58c8, 0x0021323537f4b190, 0x0042646a6fe96320, 0x0084c8d4dfd2c63f,
+					0x001a8e90f9908e0d, 0x08054fb698501c69, 0x080a9f6d30a038d2, 0x08153eda614071a4,
+					0x002a7db4c280e347, 0x0054fb698501c68f, 0x0810ff151a99f483, 0x0021fe2a3533e906,
+					0x0043fc546a67d20c, 0x080d98ddaee19069, 0x001b31bb5dc320d2, 0x00366376bb8641a3,
+					0x080ae0b158b47387, 0x0015c162b168e70e, 0x002b82c562d1ce1c, 0x0057058ac5a39c38,
+					0x00ae0b158b473870, 0x0022cf044f0e3e7d, 0x0806f6340fcfa619, 0x080dec681f9f4c32,
+					0x001bd8d03f3e9864, 0x0037b1a07e7d30c8, 0x080b23867fb2a35b, 0x0016470cff6546b6,
+					0x002c8e19feca8d6d, 0x00591c33fd951ad9, 0x0811d270cc51055f, 0x0023a4e198a20abd,
+					0x004749c33144157b, 0x080e41f3d6a7377f, 0x0802d9fd9154a4b3, 0x0805b3fb22a94966,
+					0x080b67f6455292cc, 0x0016cfec8aa52598, 0x002d9fd9154a4b30, 0x08091ff83775423d,
+					0x08123ff06eea847a, 0x00247fe0ddd508f3, 0x0048ffc1bbaa11e6, 0x080e998d258869fb,
+					0x001d331a4b10d3f6, 0x003a66349621a7eb, 0x0074cc692c434fd6, 0x00175c1508da432b,
+					0x002eb82a11b48656, 0x0809580869f0e7ab, 0x0812b010d3e1cf56, 0x00256021a7c39eab,
+					0x004ac0434f873d56, 0x080ef340a98172ab, 0x001de6815302e556, 0x003bcd02a605caab,
+					0x080bf5cd54678eef, 0x0017eb9aa8cf1dde, 0x002fd735519e3bbc, 0x005fae6aa33c7778,
+					0x081322e220a5b17f, 0x0803d3c6d35456b3, 0x0807a78da6a8ad66, 0x080f4f1b4d515acc,
+					0x001e9e369aa2b597, 0x08061fa48553bdeb, 0x080c3f490aa77bd6, 0x00187e92154ef7ac,
+					0x0030fd242a9def58, 0x0061fa48553bdeb0, 0x08139874ddd8c623, 0x002730e9bbb18c47,
+					0x0807d6952589e8db, 0x100191510781fb5f, 0x080322a20f03f6be, 0x080645441e07ed7c,
+					0x080c8a883c0fdaf8, 0x00191510781fb5f0, 0x00322a20f03f6bdf, 0x00645441e07ed7bf,
+					0x081410d9f9b2f7f3, 0x0804035ecb8a3197, 0x080806bd9714632e, 0x08100d7b2e28c65c,
+					0x00201af65c518cb8, 0x004035ecb8a31970, 0x00806bd9714632e0, 0x0019af2b7d0e0a2d,
+					0x00335e56fa1c145a, 0x080a46116538d0df, 0x10020e037aa4f693, 0x08041c06f549ed26,
+					0x0808380dea93da4c, 0x0810701bd527b498, 0x0020e037aa4f692f, 0x0041c06f549ed25e,
+					0x080d267caa862a13, 0x0802a14c221ad537, 0x080542984435aa6e, 0x080a8530886b54dc,
+					0x08150a6110d6a9b8, 0x002a14c221ad536f, 0x00542984435aa6df, 0x0810d51a73deee2d,
+					0x08035dd2172c9609, 0x0806bba42e592c12, 0x080d77485cb25824, 0x001aee90b964b047,
+					0x080562e9beadbcdb, 0x080ac5d37d5b79b6, 0x00158ba6fab6f36c, 0x002b174df56de6d9,
+					0x00562e9beadbcdb1, 0x00ac5d37d5b79b62, 0x0022790b2abe5247, 0x0044f216557ca48e,
+					0x0089e42caaf9491b, 0x001b9408eefea839, 0x08058401c96621a5, 0x080b080392cc434a,
+					0x0016100725988694, 0x002c200e4b310d27, 0x0058401c96621a4f, 0x0811a66c1e139edd,
+					0x00234cd83c273db9, 0x004699b0784e7b72, 0x080e1ebce4dc7f17, 0x0802d2f2942c196b,
+					0x0805a5e5285832d6, 0x080b4bca50b065ac, 0x00169794a160cb58, 0x002d2f2942c196b0,
+					0x005a5e5285832d5f, 0x081212dd4de70913, 0x002425ba9bce1226, 0x00484b75379c244c,
+					0x009096ea6f384898, 0x001ceafbafd80e85, 0x0039d5f75fb01d0a, 0x0073abeebf603a13,
+					0x00172262f3133ed1, 0x002e44c5e6267da1, 0x080940f4613ae5ed, 0x081281e8c275cbda,
+					0x002503d184eb97b4, 0x004a07a309d72f69, 0x080ece53cec4a315, 0x001d9ca79d89462a,
+					0x003b394f3b128c54, 0x080bd8430bd08277, 0x0017b08617a104ee, 0x0804bce79e536763,
+					0x080979cf3ca6cec6, 0x0812f39e794d9d8c, 0x0025e73cf29b3b17, 0x004bce79e536762e,
+					0x080f294b943e17a3, 0x001e5297287c2f45, 0x003ca52e50f85e8b, 0x00794a5ca1f0bd16,
+					0x0018421286c9bf6b, 0x003084250d937ed6, 0x0061084a1b26fdab, 0x0813680ed23aff89,
+					0x0026d01da475ff11, 0x004da03b48ebfe22, 0x009b407691d7fc45, 0x001f0ce4839198db,
+					0x003e19c9072331b5, 0x080c6b8e9b0709f1, 0x0018d71d360e13e2, 0x0031ae3a6c1c27c4,
+					0x00635c74d8384f88, 0x0813df4a91a4dcb5, 0x0027be952349b96a, 0x004f7d2a469372d3,
+					0x080fe5d54150b091, 0x001fcbaa82a16121, 0x08065beee6ed136d, 0x100145962e2f6a49,
+					0x08028b2c5c5ed492, 0x08051658b8bda924, 0x080a2cb1717b5248, 0x08145962e2f6a490,
+					0x0028b2c5c5ed4920, 0x080823c12795db6d, 0x081047824f2bb6da, 0x00208f049e576db4,
+					0x00411e093caedb67, 0x080d0601d8efc57b, 0x08029acd2b63277f, 0x0805359a56c64efe,
+					0x080a6b34ad8c9dfc, 0x0814d6695b193bf8, 0x0029acd2b63277f0, 0x080855c3be0a17fd,
+					0x0810ab877c142ffa, 0x0021570ef8285ff3, 0x0806ab02fe6e7997, 0x10015566ffafb1eb,
+					0x10004447ccbcbd2f, 0x1000888f99797a5e, 0x1001111f32f2f4bc, 0x0802223e65e5e978,
+					0x0804447ccbcbd2f0, 0x080888f99797a5e0, 0x081111f32f2f4bc0, 0x002223e65e5e9780,
+					0x004447ccbcbd2f01, 0x00888f99797a5e01, 0x001b4feb7eb212cd, 0x00369fd6fd64259a,
+					0x006d3fadfac84b34, 0x0015d98932280f0b, 0x002bb31264501e15, 0x00576624c8a03c2a,
+					0x00aecc4991407853, 0x0022f5a850401811, 0x0045eb50a0803021, 0x080dfbdcece67007,
+					0x001bf7b9d9cce00d, 0x0037ef73b399c01b, 0x080b2fe3f0b8599f, 0x00165fc7e170b33e,
+					0x002cbf8fc2e1667c, 0x00597f1f85c2ccf8, 0x0811e6398126f5cb, 0x0023cc73024deb96,
+					0x004798e6049bd72c, 0x008f31cc0937ae59, 0x001ca38f350b22df, 0x0805ba4fd768a093,
+					0x080b749faed14126, 0x0016e93f5da2824c, 0x002dd27ebb450497, 0x005ba4fd768a092f,
+					0x08125432b14ecea3, 0x0024a865629d9d46, 0x004950cac53b3a8c, 0x080ea9c227723ee9,
+					0x0802eec06e4a0c95, 0x0805dd80dc94192a, 0x080bbb01b9283254, 0x00177603725064a8,
+					0x002eec06e4a0c94f, 0x005dd80dc941929e, 0x0812c4cf8ea6b6ed, 0x0025899f1d4d6dd9,
+					0x080781ec9f75e2c5, 0x080f03d93eebc58a, 0x001e07b27dd78b14, 0x003c0f64fbaf1628,
+					0x00781ec9f75e2c50, 0x0018062864ac6f43, 0x0804ce0814227ca7, 0x08099c102844f94e,
+					0x081338205089f29c, 0x00267040a113e538, 0x0807b00ced03faa5, 0x1001899c2f673221,
+					0x080313385ece6442, 0x08062670bd9cc884, 0x080c4ce17b399108, 0x001899c2f6732210,
+					0x00313385ece6441f, 0x0062670bd9cc883e, 0x0813ae3591f5b4d9, 0x00275c6b23eb69b2,
+					0x004eb8d647d6d365, 0x080fbe9141915d7b, 0x001f7d228322baf5, 0x003efa45064575ea,
+					0x007df48a0c8aebd5, 0x001930e868e89591, 0x080509c814fb511d, 0x100101f4d0ff1039,
+					0x100203e9a1fe2072, 0x080407d343fc40e4, 0x08080fa687f881c8, 0x08101f4d0ff10390,
+					0x00203e9a1fe20720, 0x00407d343fc40e40, 0x0080fa687f881c80, 0x0019cbae7fe805b3,
+					0x080528bc7ffb3457, 0x10010825b3323dab, 0x1002104b66647b56, 0x08042096ccc8f6ac,
+					0x0808412d9991ed58, 0x0810825b3323dab0, 0x002104b66647b560, 0x08069a8ae1418aad,
+					0x080d3515c283155a, 0x001a6a2b85062ab3, 0x0805486f1a9ad557, 0x080a90de3535aaae,
+					0x081521bc6a6b555c, 0x002a4378d4d6aab9, 0x080873e4f75e2225, 0x0810e7c9eebc444a,
+					0x0021cf93dd788894, 0x00439f27baf11127, 0x080d863b256369d5, 0x0802b4723aad7b91,
+					0x10008a7d3eef7f1d, 0x18001bb2a62fe639, 0x1800058a213cc7a5, 0x2000011ba03f5b21,
+					0x28000038b9a6456d, 0x3000000b58547449, 0x28000016b0a8e892, 0x2800002d6151d124,
+					0x2800005ac2a3a248, 0x200000b585474490, 0x2000016b0a8e8920, 0x200002d6151d1240,
+					0x180005ac2a3a2480, 0x18000b5854744900, 0x180016b0a8e89200, 0x18002d6151d12400,
+					0x10005ac2a3a24800, 0x1000b58547449000, 0x10016b0a8e892000, 0x0802d6151d124000,
+					0x0805ac2a3a248000, 0x080b585474490000, 0x0016b0a8e8920000, 0x002d6151d123ffff,
+					0x005ac2a3a247fffe, 0x081226ed86db3333, 0x00244ddb0db66665, 0x080742c569247ae1,
+					0x080e858ad248f5c2, 0x001d0b15a491eb84, 0x003a162b4923d709, 0x080b9e08a83a5e35,
+					0x080252ce880bac71, 0x0804a59d101758e2, 0x08094b3a202eb1c4, 0x08129674405d6388,
+					0x00252ce880bac710, 0x004a59d101758e20, 0x080edec366b11c6d, 0x001dbd86cd6238d9,
+					0x003b7b0d9ac471b3, 0x0076f61b3588e366, 0x0017cad23de82d7b, 0x002f95a47bd05af6,
+					0x005f2b48f7a0b5eb, 0x081308a831868ac9, 0x00261150630d1591, 0x004c22a0c61a2b22,
+					0x009845418c345645, 0x001e74404f3daadb, 0x003ce8809e7b55b5, 0x0079d1013cf6ab6a,
+					0x00185d003f6488af, 0x0030ba007ec9115e, 0x00617400fd9222bb, 0x08137d99cc506d59,
+					0x0026fb3398a0dab1, 0x004df6673141b563, 0x080f97ae3d0d2447, 0x001f2f5c7a1a488e,
+					0x003e5eb8f434911c, 0x080c795830d75039, 0x0018f2b061aea072, 0x0031e560c35d40e3,
+					0x0063cac186ba81c6, 0x0813f559e7bee6c1, 0x0027eab3cf7dcd82, 0x0807fbbd8fe5f5e7,
+					0x100198bf832dfdfb, 0x0803317f065bfbf6
+				};
+			};
+		}
+	}
+}
+
+#endif
@@ -242,6 +242,14 @@ namespace jkj::fp {
 				return g0.high();
 			}
 
+			// Computes upper 128-bits of multiplication of a 64-bit unsigned integer
+			// and a 128-bit unsigned integer.
+			JKJ_SAFEBUFFERS inline uint128 umul192_upper128(std::uint64_t x, uint128 y) noexcept {
+				auto g0 = umul128(x, y.high());
+				g0 += umul128_upper64(x, y.low());
+				return g0;
+			}
+
 			// Computes upper 32-bits of multiplication of a 32-bit unsigned integer
 			// and a 64-bit unsigned integer.
 			inline std::uint32_t umul96_upper32(std::uint32_t x, std::uint64_t y) noexcept {
@@ -21,14 +21,22 @@
 #include "decimal_fp.h"
 #include "dragonbox.h"
 #include "policy.h"
+#include "ryu_printf.h"
 #include "detail/bits.h"
 #include "detail/div.h"
 #include "detail/log.h"
 #include "detail/util.h"
+#include "detail/macros.h"
 #include <cassert>
+#include <cfloat>
 #include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 namespace jkj::fp {
+	// to_binary_limited_precision accepts any significand fitting in the carrier type,
+	// but only those with at most this many digits take the fast path.
 	template <ieee754_format format>
 	static constexpr int to_binary_limited_precision_digit_limit =
 		format == ieee754_format::binary32 ? 9 : 17;
@@ -55,6 +63,14 @@ namespace jkj::fp {
 					log::floor_log10_pow2(max_exponent + 1);
 			};
 
+			template <class Float, class PowerList>
+			struct exact_pow10_table_impl;
+
+			template <class Float, std::size_t... k>
+			struct exact_pow10_table_impl<Float, std::index_sequence<k...>> {
+				static constexpr Float table[] = { compute_power<k>(Float(10))... };
+			};
+
 			template <class Float>
 			struct impl : private impl_base<ieee754_traits<Float>::format>
 			{
@@ -85,23 +101,66 @@ namespace jkj::fp {
 				static constexpr int max_power_of_factor_of_5 =
 					log::floor_log5_pow2(decimal_digit_limit) + decimal_digit_limit;
 
+				// Clinger's fast path: if both the significand and 10^|k| are exactly
+				// representable, a single correctly rounded multiplication or division
+				// gives the answer. This assumes that floating-point operations are
+				// evaluated in the precision of Float, and that the rounding mode is the
+				// default one, which is what binary_rounding::nearest_to_even asks for.
+				static constexpr bool has_exact_fast_path = FLT_EVAL_METHOD == 0;
+				static constexpr auto max_exact_significand =
+					carrier_uint(carrier_uint(1) << (significand_bits + 1));
+				static constexpr int max_exact_power_of_10 =
+					log::floor_log5_pow2(significand_bits + 1);
+				using exact_pow10_table = exact_pow10_table_impl<Float,
+					std::make_index_sequence<max_exact_power_of_10 + 1>>;
+
 				template <class IntervalTypeProvider, class SignPolicy, class CachePolicy, class InputType>
 				static ieee754_bits<Float> compute(InputType decimal) noexcept
 				{
-					assert(decimal.significand <= max_significand);
 					ieee754_bits<Float> ret_value{ carrier_uint(0) };
 
+					// Infinity, or the maximum finite number if the magnitude is rounded down
+					constexpr carrier_uint overflow_bits = IntervalTypeProvider::tag ==
+						policy::binary_rounding::tag_t::left_closed_directed ? infinity - 1 : infinity;
+
 					// Set sign bit
 					SignPolicy::decimal_to_binary(decimal, ret_value);
 
+					if constexpr (has_exact_fast_path &&
+						std::is_same_v<std::remove_cv_t<IntervalTypeProvider>,
+						policy::binary_rounding::nearest_to_even>)
+					{
+						if (decimal.significand <= max_exact_significand &&
+							decimal.exponent >= -max_exact_power_of_10 &&
+							decimal.exponent <= max_exact_power_of_10)
+						{
+							auto const f = Float(decimal.significand);
+							ret_value.u |= ieee754_bits<Float>{ decimal.exponent >= 0 ?
+								f * exact_pow10_table::table[decimal.exponent] :
+								f / exact_pow10_table::table[-decimal.exponent] }.u;
+							return ret_value;
+						}
+					}
+
+					if (decimal.significand > max_significand) {
+						return compute_wide<IntervalTypeProvider, SignPolicy, CachePolicy>(
+							decimal, ret_value);
+					}
+
 					// Special cases
 					if (decimal.significand == 0 || decimal.exponent < min_k) {
-						// Zero
+						// Zero, or the minimum nonzero number if the magnitude is rounded up
+						if constexpr (IntervalTypeProvider::tag ==
+							policy::binary_rounding::tag_t::right_closed_directed)
+						{
+							if (decimal.significand != 0) {
+								ret_value.u |= 1;
+							}
+						}
 						return ret_value;
 					}
 					else if (decimal.exponent > max_k) {
-						// Infinity
-						ret_value.u |= infinity;
+						ret_value.u |= overflow_bits;
 						return ret_value;
 					}
 
@@ -136,9 +195,10 @@ namespace jkj::fp {
 								return ret_value;
 							}
 							// Zero or subnormal, depending on the boundary condition
+							// The interval type of zero may depend on the sign
 							else if (bin_exponent == min_exponent - significand_bits - 1) {
-								if constexpr (IntervalTypeProvider::interval_type_normal(
-									ieee754_bits<Float>{ carrier_uint(0) }).include_right_endpoint())
+								if (IntervalTypeProvider::interval_type_normal(
+									ieee754_bits<Float>{ ret_value.u }).include_right_endpoint())
 								{
 									// The middle point between 0 and the minimum nonzero number
 									// should be rounded to 0
@@ -173,6 +233,14 @@ namespace jkj::fp {
 								return ret_value;
 							}
 						}
+						else
+						{
+							// The minimum nonzero number
+							if (bin_exponent <= min_exponent - significand_bits - 1) {
+								ret_value.u |= 1;
+								return ret_value;
+							}
+						}
 
 						// Subnormal
 						residual_mask = normal_residual_mask + 1;
@@ -261,9 +329,9 @@ namespace jkj::fp {
 					}
 
 				compose_bits_label:
-					// Overflow; infinity
+					// Overflow
 					if (bin_exponent > max_exponent) {
-						ret_value.u |= infinity;
+						ret_value.u |= overflow_bits;
 						return ret_value;
 					}
 
@@ -275,6 +343,473 @@ namespace jkj::fp {
 					return ret_value;
 				}
 
+				// Converts [first, last) to out. The first pass over each block handles
+				// the common case, which is a normal number not too close to a rounding
+				// boundary, without data-dependent branches; the second pass redoes the
+				// remaining ones with compute.
+				template <class IntervalTypeProvider, class SignPolicy, class CachePolicy,
+					class InputType>
+				static void compute_batch(InputType const* first, InputType const* last,
+					Float* out) noexcept
+				{
+					convert_by_blocks(first, last, out,
+						[](InputType const& decimal, carrier_uint& result) {
+							return compute_common_case<IntervalTypeProvider, CachePolicy>(
+								decimal.significand, decimal.exponent, result);
+						},
+						[](InputType const& decimal) {
+							return compute<IntervalTypeProvider, SignPolicy, CachePolicy>(
+								decimal).to_float();
+						});
+				}
+
+				// Runs kernel(input, result) for each input in blocks, and then
+				// fallback(input) for each input the kernel returned false.
+				template <class InputType, class Kernel, class Fallback>
+				JKJ_FORCEINLINE static void convert_by_blocks(InputType const* first,
+					InputType const* last, Float* out, Kernel&& kernel, Fallback&& fallback) noexcept
+				{
+					constexpr std::size_t block_size = 64;
+					while (first != last) {
+						auto const count = std::size_t(last - first) < block_size ?
+							std::size_t(last - first) : block_size;
+
+						std::uint64_t fallback_mask = 0;
+						for (std::size_t i = 0; i < count; ++i) {
+							carrier_uint result;
+							bool const success = kernel(first[i], result);
+							out[i] = ieee754_traits<Float>::carrier_to_float(result);
+							fallback_mask |= (std::uint64_t(success ? 0 : 1) << i);
+						}
+
+						while (fallback_mask != 0) {
+							auto const i = bits::countr_zero(fallback_mask);
+							out[i] = fallback(first[i]);
+							fallback_mask &= (fallback_mask - 1);
+						}
+
+						first += count;
+						out += count;
+					}
+				}
+
+				// The main path of compute, without the special cases. Returns false
+				// if the input needs one of them; result is then unspecified.
+				template <class IntervalTypeProvider, class CachePolicy>
+				JKJ_FORCEINLINE static bool compute_common_case(carrier_uint significand,
+					int exponent, carrier_uint& result) noexcept
+				{
+					bool const is_in_range = (significand != 0) & (significand <= max_significand) &
+						(exponent >= min_k) & (exponent <= max_k);
+					significand = is_in_range ? significand : 1;
+					exponent = is_in_range ? exponent : 0;
+
+					auto const& cache = CachePolicy::template get_cache<format>(exponent);
+					return is_in_range & compute_normal_case<IntervalTypeProvider>(significand,
+						cache, carrier_bits + log::floor_log2_pow10(exponent) - 1, result);
+				}
+
+				// The rounding of significand * 10^k, where bin_exponent_base is
+				// carrier_bits + floor(k * log2(10)) - 1 and cache is the cache for k.
+				// Returns false if the result is not normal or is on a boundary.
+				template <class IntervalTypeProvider, class Cache>
+				JKJ_FORCEINLINE static bool compute_normal_case(carrier_uint significand,
+					Cache const& cache, int bin_exponent_base, carrier_uint& result) noexcept
+				{
+					auto const tau = bits::countl_zero(significand);
+					auto gi = dragonbox::impl<Float>::compute_mul(significand << tau, cache);
+					int bin_exponent = bin_exponent_base - tau;
+
+					auto const top_bit = int(gi >> (carrier_bits - 1));
+					gi >>= top_bit;
+					bin_exponent += top_bit;
+
+					bool const is_normal =
+						(bin_exponent >= min_exponent) & (bin_exponent <= max_exponent);
+
+					// Overflow into the exponent bits is the correct behavior.
+					auto const remainder = gi & normal_residual_mask;
+					result = (carrier_uint(bin_exponent - exponent_bias) << significand_bits)
+						+ ((gi << 2) >> (carrier_bits - significand_bits));
+
+					bool is_on_boundary = false;
+					if constexpr (IntervalTypeProvider::tag ==
+						policy::binary_rounding::tag_t::to_nearest)
+					{
+						is_on_boundary = remainder == normal_distance_to_boundary;
+						result += carrier_uint(remainder > normal_distance_to_boundary ? 1 : 0);
+					}
+					else if constexpr (IntervalTypeProvider::tag ==
+						policy::binary_rounding::tag_t::right_closed_directed)
+					{
+						is_on_boundary = remainder == 0;
+						result += carrier_uint(remainder != 0 ? 1 : 0);
+					}
+
+					return is_normal & !is_on_boundary;
+				}
+
+				// Converts significand * 10^exponent for each significand in [first, last),
+				// where the cache lookup is done only once. The interval type providers for
+				// positive and negative numbers are given separately.
+				template <class PositiveIntervalTypeProvider, class NegativeIntervalTypeProvider,
+					class SignPolicy, class CachePolicy, class SignedInt>
+				static void compute_fixed_exponent(SignedInt const* first, SignedInt const* last,
+					int exponent, Float* out) noexcept
+				{
+					ieee754_bits<Float> negative_sign_bits{ carrier_uint(0) };
+					SignPolicy::decimal_to_binary(
+						signed_decimal_fp<Float>{ carrier_uint(0), 0, true }, negative_sign_bits);
+
+					auto magnitude = [](SignedInt value) {
+						return value < 0 ? carrier_uint(carrier_uint(0) - carrier_uint(value)) :
+							carrier_uint(value);
+					};
+					auto compute_scalar = [exponent, magnitude](SignedInt value) {
+						signed_decimal_fp<Float> decimal;
+						decimal.significand = magnitude(value);
+						decimal.exponent = exponent;
+						decimal.is_negative = value < 0;
+						return (decimal.is_negative ?
+							compute<NegativeIntervalTypeProvider, SignPolicy, CachePolicy>(decimal) :
+							compute<PositiveIntervalTypeProvider, SignPolicy, CachePolicy>(decimal)
+							).to_float();
+					};
+
+					if (exponent < min_k || exponent > max_k) {
+						for (; first != last; ++first, ++out) {
+							*out = compute_scalar(*first);
+						}
+						return;
+					}
+
+					// Clinger's fast path, as in compute.
+					if constexpr (has_exact_fast_path &&
+						std::is_same_v<std::remove_cv_t<PositiveIntervalTypeProvider>,
+						policy::binary_rounding::nearest_to_even> &&
+						std::is_same_v<std::remove_cv_t<NegativeIntervalTypeProvider>,
+						policy::binary_rounding::nearest_to_even>)
+					{
+						if (exponent >= -max_exact_power_of_10 && exponent <= max_exact_power_of_10) {
+							bool const is_division = exponent < 0;
+							auto const power_of_10 =
+								exact_pow10_table::table[is_division ? -exponent : exponent];
+							convert_by_blocks(first, last, out,
+								[&](SignedInt value, carrier_uint& result) {
+									auto const significand = magnitude(value);
+									auto const f = Float(significand);
+									result = ieee754_bits<Float>{
+										is_division ? f / power_of_10 : f * power_of_10 }.u;
+									result |= (value < 0 ? negative_sign_bits.u : carrier_uint(0));
+									return significand <= max_exact_significand;
+								}, compute_scalar);
+							return;
+						}
+					}
+
+					auto const cache = CachePolicy::template get_cache<format>(exponent);
+					int const bin_exponent_base = carrier_bits + log::floor_log2_pow10(exponent) - 1;
+
+					convert_by_blocks(first, last, out,
+						[&](SignedInt value, carrier_uint& result) {
+							auto significand = magnitude(value);
+							bool const is_in_range =
+								(significand != 0) & (significand <= max_significand);
+							significand = is_in_range ? significand : 1;
+
+							bool success = compute_normal_case<PositiveIntervalTypeProvider>(
+								significand, cache, bin_exponent_base, result);
+							if constexpr (!std::is_same_v<PositiveIntervalTypeProvider,
+								NegativeIntervalTypeProvider>)
+							{
+								carrier_uint negative_result;
+								bool const negative_success =
+									compute_normal_case<NegativeIntervalTypeProvider>(
+										significand, cache, bin_exponent_base, negative_result);
+								result = value < 0 ? negative_result : result;
+								success = value < 0 ? negative_success : success;
+							}
+							result |= (value < 0 ? negative_sign_bits.u : carrier_uint(0));
+							return success & is_in_range;
+						}, compute_scalar);
+				}
+
+				// Significands with more than decimal_digit_limit digits.
+				// The 192-bit product with the cache decides almost all of them;
+				// otherwise, the rounding of the first decimal_digit_limit digits is
+				// corrected by comparing the digits with those of the boundary point.
+				template <class IntervalTypeProvider, class SignPolicy, class CachePolicy,
+					class InputType>
+				static ieee754_bits<Float> compute_wide(InputType decimal,
+					ieee754_bits<Float> ret_value) noexcept
+				{
+					if (compute_enclosed<IntervalTypeProvider, CachePolicy>(
+						std::uint64_t(decimal.significand), 0, decimal.exponent, ret_value))
+					{
+						return ret_value;
+					}
+
+					constexpr int max_digits = std::numeric_limits<carrier_uint>::digits10 + 1;
+					constexpr auto const& pow10 = pow_table<std::uint64_t, 10, max_digits>::table;
+					int digits = decimal_digit_limit + 1;
+					while (digits < max_digits && std::uint64_t(decimal.significand) >= pow10[digits]) {
+						++digits;
+					}
+
+					auto truncated = decimal;
+					truncated.significand =
+						carrier_uint(decimal.significand / pow10[digits - decimal_digit_limit]);
+					truncated.exponent += digits - decimal_digit_limit;
+
+					integer_digit_reader reader{ std::uint64_t(decimal.significand), digits };
+					return round_by_digit_comparison<IntervalTypeProvider>(
+						compute<IntervalTypeProvider, SignPolicy, CachePolicy>(truncated),
+						truncated.exponent, reader);
+				}
+
+				// Reads the digits of an integer from the most significant one.
+				struct integer_digit_reader {
+					std::uint64_t value;
+					int remaining_digits;
+
+					bool empty() const noexcept {
+						return remaining_digits == 0;
+					}
+
+					// Reads count digits, padding with zeros after the last digit.
+					std::uint32_t read(int count) noexcept {
+						constexpr auto const& pow10 = pow_table<std::uint64_t, 10, 20>::table;
+						assert(count <= 9);
+						if (count >= remaining_digits) {
+							auto const result =
+								std::uint32_t(value) * std::uint32_t(pow10[count - remaining_digits]);
+							value = 0;
+							remaining_digits = 0;
+							return result;
+						}
+						remaining_digits -= count;
+						auto const result = std::uint32_t(value / pow10[remaining_digits]);
+						value %= pow10[remaining_digits];
+						return result;
+					}
+				};
+
+				// f is the rounding of the first decimal_digit_limit digits of the input, and
+				// exponent is the decimal exponent of them as an integer. Decides between f
+				// and the next number by reading all the digits of the input from reader,
+				// which provides read(count) returning the next count digits, padded with
+				// zeros at the end, and empty().
+				template <class IntervalTypeProvider, class DigitReader>
+				static ieee754_bits<Float> round_by_digit_comparison(ieee754_bits<Float> f,
+					int exponent, DigitReader& reader) noexcept
+				{
+					if (!f.is_finite()) {
+						// The truncated significand already overflows.
+						return f;
+					}
+
+					// The result is either f or the next number, depending on whether the input
+					// is below or above the boundary point. The boundary point is:
+					//  - the middle point between f and the next number for round-to-nearest,
+					//  - the next number if the magnitude is rounded down, and
+					//  - f itself if the magnitude is rounded up,
+					// because f is computed from the truncated significand using the same rounding.
+					using policy::binary_rounding::tag_t;
+					constexpr auto tag = IntervalTypeProvider::tag;
+					auto boundary = f;
+					if constexpr (tag == tag_t::left_closed_directed) {
+						++boundary.u;
+						if (!boundary.is_finite()) {
+							return f;
+						}
+					}
+
+					// Generate digits of the boundary point.
+					fp::ryu_printf<Float> digit_gen{ boundary,
+						std::bool_constant<tag == tag_t::to_nearest>{} };
+
+					// Compare g (significand) times 10^(k + n * eta) to s (the boundary point),
+					// where k is the decimal exponent, n is the segment index,
+					// and eta is the segment length.
+					// Let d be the number of digits of g, then:
+					//  - if k + n * eta + d - 1 >= eta, then g * 10^(k + n * eta) > s.
+					//  - if k + n * eta + d <= 0, then g * 10^(k + n * eta) < s.
+					//  - the above two conditions are not met if and only if
+					//    0 <= k + n * eta + d - 1 < eta.
+					auto initial_comparison_digits = exponent + decimal_digit_limit
+						+ digit_gen.current_segment_index() * fp::ryu_printf<Float>::segment_size;
+
+					if (initial_comparison_digits <= 0) {
+						// Boundary point is strictly greater.
+						return f;
+					}
+					else if (initial_comparison_digits > fp::ryu_printf<Float>::segment_size) {
+						// Boundary point is strictly smaller.
+						++f.u;
+						return f;
+					}
+					else {
+						static_assert(decimal_digit_limit >= fp::ryu_printf<Float>::segment_size);
+
+						auto const significand32 = reader.read(initial_comparison_digits);
+
+						if (significand32 > digit_gen.current_segment()) {
+							// Boundary point is strictly smaller.
+							++f.u;
+							return f;
+						}
+						else if (significand32 < digit_gen.current_segment()) {
+							// Boundary point is strictly greater.
+							return f;
+						}
+					}
+
+					while (!reader.empty()) {
+						digit_gen.compute_next_segment();
+
+						auto const significand32 = reader.read(fp::ryu_printf<Float>::segment_size);
+
+						if (significand32 > digit_gen.current_segment()) {
+							// Boundary point is strictly smaller.
+							++f.u;
+							return f;
+						}
+						else if (significand32 < digit_gen.current_segment()) {
+							// Boundary point is strictly bigger.
+							return f;
+						}
+					}
+
+					if (digit_gen.has_further_nonzero_segments()) {
+						// Boundary point is strictly bigger.
+						return f;
+					}
+
+					// Tie!
+					if constexpr (tag == tag_t::to_nearest) {
+						if (!IntervalTypeProvider::interval_type_normal(f).include_right_endpoint()) {
+							++f.u;
+						}
+					}
+					else if constexpr (tag == tag_t::left_closed_directed) {
+						++f.u;
+					}
+
+					return f;
+				}
+
+				// Tries to find the rounding of every real number in
+				// [significand, significand + 1) * 10^exponent.
+				// Returns false if that interval may contain a rounding boundary,
+				// or if the result might not be a normal number.
+				// The sign bit is not touched.
+				template <class IntervalTypeProvider, class CachePolicy>
+				static bool compute_truncated(std::uint64_t significand, int exponent,
+					ieee754_bits<Float>& result) noexcept
+				{
+					return compute_enclosed<IntervalTypeProvider, CachePolicy>(
+						significand, 1, exponent, result);
+				}
+
+				// Same as compute_truncated, but for the interval
+				// [significand, significand + width] * 10^exponent, where width is 0 or 1.
+				template <class IntervalTypeProvider, class CachePolicy>
+				static bool compute_enclosed(std::uint64_t significand, std::uint64_t width,
+					int exponent, ieee754_bits<Float>& result) noexcept
+				{
+					using cache_holder = dragonbox::cache_holder<ieee754_format::binary64>;
+					if (significand == 0 ||
+						exponent < cache_holder::min_k || exponent > cache_holder::max_k)
+					{
+						return false;
+					}
+
+					auto const tau = bits::countl_zero(significand);
+					auto const lower_significand = significand << tau;
+					auto const upper_significand = lower_significand + (width << tau);
+					if (upper_significand < lower_significand) {
+						return false;
+					}
+
+					// The cache is a 128-bit approximation of 10^k * 2^(127 - floor(k * log2(10)))
+					// with an error less than 1, so the 192-bit products computed below are
+					// off by less than 2^64. Hence, we can enclose the interval by
+					// [lower - 1, upper + 2] where lower and upper are the upper 128-bits.
+					auto const& cache = CachePolicy::template get_cache<ieee754_format::binary64>(exponent);
+					auto lower = wuint::umul192_upper128(lower_significand, cache);
+					auto upper = wuint::umul192_upper128(upper_significand, cache);
+
+					lower = wuint::uint128{ lower.high() - (lower.low() == 0 ? 1 : 0), lower.low() - 1 };
+					if (upper.high() == std::uint64_t(-1) && upper.low() >= std::uint64_t(-2)) {
+						return false;
+					}
+					upper += 2;
+
+					// Both numbers are inside [2^126, 2^128), and the real number they represent
+					// is obtained by multiplying 2^(floor(k * log2(10)) - 63 - tau).
+					int const exponent_offset = log::floor_log2_pow10(exponent) - 63 - tau;
+
+					carrier_uint lower_bits, upper_bits;
+					if (!round_truncated<IntervalTypeProvider>(lower, exponent_offset, lower_bits) ||
+						!round_truncated<IntervalTypeProvider>(upper, exponent_offset, upper_bits) ||
+						lower_bits != upper_bits)
+					{
+						return false;
+					}
+
+					result.u |= lower_bits;
+					return true;
+				}
+
+				// Rounds x * 2^exponent_offset to a normal number.
+				// Returns false if x is exactly on a boundary, or if the result is not normal.
+				// Since the boundaries are avoided, how ties are broken does not matter.
+				template <class IntervalTypeProvider>
+				static bool round_truncated(wuint::uint128 x, int exponent_offset,
+					carrier_uint& bits) noexcept
+				{
+					// Find the binary exponent.
+					int const msb_pos = (x.high() >> 63) != 0 ? 127 : 126;
+					int const bin_exponent = msb_pos + exponent_offset;
+					if (bin_exponent < min_exponent || bin_exponent > max_exponent) {
+						return false;
+					}
+
+					// The number of bits to be discarded, which is always greater than 64.
+					int const shift = msb_pos - significand_bits;
+					static_assert(126 - significand_bits > 64);
+
+					auto const significand = x.high() >> (shift - 64);
+					auto const remainder_high = x.high() & ((std::uint64_t(1) << (shift - 64)) - 1);
+
+					bits = carrier_uint(bin_exponent - exponent_bias) << significand_bits;
+					bits += carrier_uint(significand) - (carrier_uint(1) << significand_bits);
+
+					// Overflow into the exponent bits is the correct behavior.
+					if constexpr (IntervalTypeProvider::tag ==
+						policy::binary_rounding::tag_t::to_nearest)
+					{
+						auto const half_high = std::uint64_t(1) << (shift - 65);
+						if (remainder_high == half_high && x.low() == 0) {
+							return false;
+						}
+						if (remainder_high > half_high || (remainder_high == half_high && x.low() != 0)) {
+							++bits;
+						}
+					}
+					else {
+						if (remainder_high == 0 && x.low() == 0) {
+							return false;
+						}
+						if constexpr (IntervalTypeProvider::tag ==
+							policy::binary_rounding::tag_t::right_closed_directed)
+						{
+							++bits;
+						}
+					}
+					return true;
+				}
+
 				static bool is_g_integer(carrier_uint f, int k, int e) noexcept
 				{
 					if (e + k < 0) {
@@ -293,18 +828,129 @@ namespace jkj::fp {
 					}
 				}
 			};
+
+			template <class... Policies>
+			constexpr auto make_policy_holder(Policies&&... policies) {
+				using policy::make_default_list;
+				using policy::make_default;
+				return policy::make_policy_holder(
+					make_default_list(
+						make_default<policy_kind::sign>(fp::policy::sign::propagate),
+						make_default<policy_kind::binary_rounding>(
+							fp::policy::binary_rounding::nearest_to_even),
+						make_default<policy_kind::cache>(fp::policy::cache::fast)),
+					std::forward<Policies>(policies)...);
+			}
+
+			// The static boundary policies choose the interval type from the parity of the input,
+			// which is not known before the conversion, so use the ordinary ones instead.
+			template <class BinaryRoundingPolicy>
+			struct decimal_to_binary_rounding {
+				using type = BinaryRoundingPolicy;
+			};
+			template <>
+			struct decimal_to_binary_rounding<
+				policy::binary_rounding::nearest_to_even_static_boundary>
+			{
+				using type = policy::binary_rounding::nearest_to_even;
+			};
+			template <>
+			struct decimal_to_binary_rounding<
+				policy::binary_rounding::nearest_to_odd_static_boundary>
+			{
+				using type = policy::binary_rounding::nearest_to_odd;
+			};
+
+			// Calls f with the interval type provider for a number whose sign bit is
+			// given by sign_bits.
+			template <class PolicyHolder, class Float, class Func>
+			JKJ_FORCEINLINE auto delegate(ieee754_bits<Float> sign_bits, Func&& f) {
+				return decimal_to_binary_rounding<
+					typename PolicyHolder::binary_rounding_policy>::type::delegate(
+						sign_bits, std::forward<Func>(f));
+			}
 		}
 	}
 
-	template <class Float, bool is_signed>
-	ieee754_bits<Float> to_binary_limited_precision(decimal_fp<Float, is_signed, false> decimal)
+	template <class Float, bool is_signed, class... Policies>
+	ieee754_bits<Float> to_binary_limited_precision(decimal_fp<Float, is_signed, false> decimal,
+		Policies&&... policies)
+	{
+		// Build policy holder type
+		using policy_holder_t = decltype(detail::dooly::make_policy_holder(
+			std::forward<Policies>(policies)...));
+
+		// Only the sign bit is used for delegation.
+		ieee754_bits<Float> sign_bits{ typename ieee754_traits<Float>::carrier_uint(0) };
+		policy_holder_t::sign_policy::decimal_to_binary(decimal, sign_bits);
+
+		return detail::dooly::delegate<policy_holder_t>(sign_bits,
+			[decimal](auto interval_type_provider) {
+				return detail::dooly::impl<Float>::template compute<
+					decltype(interval_type_provider),
+					typename policy_holder_t::sign_policy,
+					typename policy_holder_t::cache_policy>(decimal);
+			});
+	}
+
+	// Converts each of [first, last) and stores the results to out, which should have room
+	// for last - first numbers. Returns one past the last number stored.
+	// Same as calling to_binary_limited_precision repeatedly, only faster.
+	template <class Float, class... Policies>
+	Float* to_binary_limited_precision_batch(unsigned_decimal_fp<Float> const* first,
+		unsigned_decimal_fp<Float> const* last, Float* out, Policies&&... policies)
+	{
+		// Build policy holder type
+		using policy_holder_t = decltype(detail::dooly::make_policy_holder(
+			std::forward<Policies>(policies)...));
+
+		// Every input is positive, so the rounding mode is decided once.
+		ieee754_bits<Float> sign_bits{ typename ieee754_traits<Float>::carrier_uint(0) };
+		detail::dooly::delegate<policy_holder_t>(sign_bits,
+			[first, last, out](auto interval_type_provider) {
+				detail::dooly::impl<Float>::template compute_batch<
+					decltype(interval_type_provider),
+					typename policy_holder_t::sign_policy,
+					typename policy_holder_t::cache_policy>(first, last, out);
+			});
+		return out + (last - first);
+	}
+
+	// Converts significand * 10^exponent for each significand in [first, last), as in
+	// a column of scaled integers sharing one decimal scale, and stores the results to out.
+	// Returns one past the last number stored.
+	// Same as calling to_binary_limited_precision repeatedly, only faster.
+	template <class Float, class... Policies>
+	Float* to_binary_limited_precision_batch(
+		std::make_signed_t<typename ieee754_traits<Float>::carrier_uint> const* first,
+		std::make_signed_t<typename ieee754_traits<Float>::carrier_uint> const* last,
+		int exponent, Float* out, Policies&&... policies)
 	{
-		// TODO: implement policies
-		return detail::dooly::impl<Float>::template compute<
-			decltype(policy::binary_rounding::nearest_to_even),
-			decltype(policy::sign::propagate),
-			decltype(policy::cache::fast)>(decimal);
+		// Build policy holder type
+		using policy_holder_t = decltype(detail::dooly::make_policy_holder(
+			std::forward<Policies>(policies)...));
+		using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
+
+		// The rounding mode may depend on the sign.
+		ieee754_bits<Float> positive_sign_bits{ carrier_uint(0) };
+		ieee754_bits<Float> negative_sign_bits{ carrier_uint(0) };
+		policy_holder_t::sign_policy::decimal_to_binary(
+			signed_decimal_fp<Float>{ carrier_uint(0), 0, true }, negative_sign_bits);
+
+		detail::dooly::delegate<policy_holder_t>(positive_sign_bits,
+			[&](auto positive_interval_type_provider) {
+				detail::dooly::delegate<policy_holder_t>(negative_sign_bits,
+					[&](auto negative_interval_type_provider) {
+						detail::dooly::impl<Float>::template compute_fixed_exponent<
+							decltype(positive_interval_type_provider),
+							decltype(negative_interval_type_provider),
+							typename policy_holder_t::sign_policy,
+							typename policy_holder_t::cache_policy>(first, last, exponent, out);
+					});
+			});
+		return out + (last - first);
 	}
 }
 
-#endif
\ No newline at end of file
+#include "detail/undef_macros.h"
+#endif
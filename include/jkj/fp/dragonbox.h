@@ -28,6 +28,7 @@
 #include "detail/wuint.h"
 #include "detail/macros.h"
 #include <cassert>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 #include <type_traits>
@@ -226,7 +227,8 @@ namespace jkj::fp {
 				//// The main algorithm assumes the input is a normal/subnormal finite number
 
 				template <class ReturnType, class IntervalTypeProvider, class SignPolicy,
-					class TrailingZeroPolicy, class DecimalRoundingPolicy, class CachePolicy>
+					class TrailingZeroPolicy, class DecimalRoundingPolicy, class CachePolicy,
+					class BranchStrategyPolicy = policy::branch_strategy::branchy>
 				JKJ_SAFEBUFFERS static ReturnType compute_nearest(ieee754_bits<Float> const br) noexcept
 				{
 					//////////////////////////////////////////////////////////////////////
@@ -273,6 +275,16 @@ namespace jkj::fp {
 					carrier_uint const two_fr = two_fc | 1;
 					carrier_uint const zi = compute_mul(two_fr << beta_minus_1, cache);
 
+					// do_not_care skips most of the conditions anyway
+					if constexpr (BranchStrategyPolicy::is_branchless &&
+						DecimalRoundingPolicy::tag != policy::decimal_rounding::tag_t::do_not_care)
+					{
+						compute_nearest_digits_branchless<TrailingZeroPolicy, DecimalRoundingPolicy>(
+							ret_value, interval_type, exponent, minus_k, cache, beta_minus_1,
+							two_fc, zi, deltai);
+						return ret_value;
+					}
+
 
 					//////////////////////////////////////////////////////////////////////
 					// Step 2: Try larger divisor; remove trailing zeros if necessary
@@ -293,7 +305,7 @@ namespace jkj::fp {
 					else if (r < deltai) {
 						// Exclude the right endpoint if necessary
 						if (r == 0 && !interval_type.include_right_endpoint() &&
-							is_product_integer<integer_check_case_id::fc_pm_half>(two_fr, exponent, minus_k))
+							is_product_integer<integer_check_case_id::fc_pm_half>(two_fr, exponent))
 						{
 							if constexpr (DecimalRoundingPolicy::tag ==
 								policy::decimal_rounding::tag_t::do_not_care)
@@ -316,8 +328,7 @@ namespace jkj::fp {
 						// to take advantage of short-circuiting
 						auto const two_fl = two_fc - 1;
 						if ((!interval_type.include_left_endpoint() ||
-							!is_product_integer<integer_check_case_id::fc_pm_half>(
-								two_fl, exponent, minus_k)) &&
+							!is_product_integer<integer_check_case_id::fc_pm_half>(two_fl, exponent)) &&
 							!compute_mul_parity(two_fl, cache, beta_minus_1))
 						{
 							goto small_divisor_case_label;
@@ -355,7 +366,7 @@ namespace jkj::fp {
 
 								// Is r divisible by 5^kappa?
 								if (div::check_divisibility_and_divide_by_pow5<kappa>(r) &&
-									is_product_integer<integer_check_case_id::fc_pm_half>(two_fr, exponent, minus_k))
+									is_product_integer<integer_check_case_id::fc_pm_half>(two_fr, exponent))
 								{
 									// This should be in the interval
 									ret_value.significand += r - 1;
@@ -401,8 +412,7 @@ namespace jkj::fp {
 									if constexpr (DecimalRoundingPolicy::tag !=
 										policy::decimal_rounding::tag_t::away_from_zero)
 									{
-										if (is_product_integer<integer_check_case_id::fc>(
-											two_fc, exponent, minus_k))
+										if (is_product_integer<integer_check_case_id::fc>(two_fc, exponent))
 										{
 											DecimalRoundingPolicy::break_rounding_tie(ret_value);
 										}
@@ -424,13 +434,105 @@ namespace jkj::fp {
 					return ret_value;
 				}
 
+				// Step 2 and Step 3 of compute_nearest, with both of the divisors tried and
+				// the result selected without branching on which one succeeds. The conditions
+				// that rarely hold on random inputs are still tested with branches.
+				template <class TrailingZeroPolicy, class DecimalRoundingPolicy,
+					class ReturnType, class IntervalType>
+				JKJ_FORCEINLINE static void compute_nearest_digits_branchless(ReturnType& ret_value,
+					IntervalType const interval_type, int const exponent, int const minus_k,
+					cache_entry_type const& cache, int const beta_minus_1,
+					carrier_uint const two_fc, carrier_uint const zi, std::uint32_t const deltai) noexcept
+				{
+					constexpr auto big_divisor = compute_power<kappa + 1>(std::uint32_t(10));
+					constexpr auto small_divisor = compute_power<kappa>(std::uint32_t(10));
+					constexpr auto mask = (std::uint32_t(1) << kappa) - 1;
+
+					auto const big_quotient = div::divide_by_pow10<kappa + 1,
+						significand_bits + kappa + 2, kappa + 1>(zi);
+					auto r = std::uint32_t(zi - big_divisor * big_quotient);
+					auto small_quotient = big_quotient;
+
+					// See compute_nearest for the endpoint conditions
+					bool big_divisor_succeeded = r < deltai;
+					if (r == 0) {
+						if (!interval_type.include_right_endpoint() &&
+							is_product_integer<integer_check_case_id::fc_pm_half>(two_fc | 1, exponent))
+						{
+							big_divisor_succeeded = false;
+							--small_quotient;
+							r = big_divisor;
+						}
+					}
+					else if (r == deltai) {
+						auto const two_fl = two_fc - 1;
+						big_divisor_succeeded = (interval_type.include_left_endpoint() &&
+							is_product_integer<integer_check_case_id::fc_pm_half>(two_fl, exponent)) ||
+							compute_mul_parity(two_fl, cache, beta_minus_1);
+					}
+
+					// The smaller divisor; when the larger one succeeds, r is replaced by deltai
+					// only to meet the preconditions.
+					auto const small_r = big_divisor_succeeded ? deltai : r;
+					auto dist = small_r - (deltai / 2) + (small_divisor / 2);
+					auto small_significand = small_quotient * 10 + div::small_division_by_pow10<kappa>(dist);
+
+					// Is dist divisible by 10^kappa?
+					if (((dist & mask) == 0) & !big_divisor_succeeded) {
+						bool const approx_y_parity = ((dist ^ (small_divisor / 2)) & 1) != 0;
+						dist >>= kappa;
+						if (div::check_divisibility_and_divide_by_pow5<kappa>(dist)) {
+							if (compute_mul_parity(two_fc, cache, beta_minus_1) != approx_y_parity) {
+								--small_significand;
+							}
+							else if constexpr (DecimalRoundingPolicy::tag !=
+								policy::decimal_rounding::tag_t::away_from_zero)
+							{
+								if (is_product_integer<integer_check_case_id::fc>(two_fc, exponent)) {
+									ReturnType tie = ret_value;
+									tie.significand = small_significand;
+									DecimalRoundingPolicy::break_rounding_tie(tie);
+									small_significand = tie.significand;
+								}
+							}
+						}
+					}
+
+					ret_value.significand = big_divisor_succeeded ? big_quotient : small_significand;
+					ret_value.exponent = minus_k + kappa + int(big_divisor_succeeded);
+
+					if (big_divisor_succeeded) {
+						TrailingZeroPolicy::on_trailing_zeros(ret_value);
+					}
+					else {
+						TrailingZeroPolicy::no_trailing_zeros(ret_value);
+					}
+				}
+
 				template <class TrailingZeroPolicy, class DecimalRoundingPolicy,
 					class CachePolicy, class ReturnType, class IntervalType>
 					JKJ_FORCEINLINE JKJ_SAFEBUFFERS static void shorter_interval_case(
 						ReturnType& ret_value, int const exponent, IntervalType const interval_type) noexcept
 				{
-					// Compute k and beta
+					// Compute k
 					int const minus_k = log::floor_log10_pow2_minus_log10_4_over_3(exponent);
+
+					// Look up the table if available
+					if constexpr (CachePolicy::has_shorter_interval_table) {
+						using table_holder = shorter_interval_table_holder<format>;
+						auto const entry = CachePolicy::template get_shorter_interval_entry<format>(
+							unsigned(exponent - exponent_bias + significand_bits));
+						if (entry != 0) {
+							constexpr auto mask = (typename table_holder::entry_type(1)
+								<< table_holder::exponent_offset_shift) - 1;
+							ret_value.significand = carrier_uint(entry & mask);
+							ret_value.exponent = minus_k + int(entry >> table_holder::exponent_offset_shift);
+							TrailingZeroPolicy::no_trailing_zeros(ret_value);
+							return;
+						}
+					}
+
+					// Compute beta
 					int const beta_minus_1 = exponent + log::floor_log2_pow10(-minus_k);
 
 					// Compute xi and zi
@@ -492,6 +594,30 @@ namespace jkj::fp {
 					}
 				}
 
+				// Integers less than 2^(significand_bits + 1) are the only values with
+				// that many digits in any of the intervals, so they are their own
+				// shortest representations.
+				template <class SignPolicy, class TrailingZeroPolicy, class ReturnType>
+				JKJ_FORCEINLINE static bool compute_integer(ieee754_bits<Float> const br,
+					ReturnType& ret_value) noexcept
+				{
+					// x = (2^q + s) * 2^-shift, where q = significand_bits
+					auto const shift = unsigned(int(significand_bits) - exponent_bias -
+						int(br.extract_exponent_bits()));
+					auto const s = br.extract_significand_bits();
+					if (shift > unsigned(significand_bits) ||
+						(s & ((carrier_uint(1) << shift) - 1)) != 0)
+					{
+						return false;
+					}
+
+					SignPolicy::binary_to_decimal(br, ret_value);
+					ret_value.significand = (s | (carrier_uint(1) << significand_bits)) >> shift;
+					ret_value.exponent = 0;
+					TrailingZeroPolicy::on_trailing_zeros(ret_value);
+					return true;
+				}
+
 				template <class ReturnType, class SignPolicy, class TrailingZeroPolicy, class CachePolicy>
 				JKJ_SAFEBUFFERS static ReturnType
 					compute_left_closed_directed(ieee754_bits<Float> const br) noexcept
@@ -502,8 +628,25 @@ namespace jkj::fp {
 
 					ReturnType ret_value;
 
-					SignPolicy::handle_sign(br, ret_value);
+					SignPolicy::binary_to_decimal(br, ret_value);
+
+					auto const bounds = left_closed_directed_bounds(br);
+					auto const cache = CachePolicy::template get_cache<format>(-bounds.minus_k);
+					compute_left_closed_directed_digits<TrailingZeroPolicy>(ret_value, bounds, cache);
+					return ret_value;
+				}
+
+				// The binary significand and exponent, and the decimal exponent
+				// to be used for the directed cases.
+				struct directed_bounds {
+					carrier_uint significand;
+					int exponent;
+					int minus_k;
+					bool closer_boundary;
+				};
 
+				static directed_bounds left_closed_directed_bounds(ieee754_bits<Float> const br) noexcept
+				{
 					auto significand = br.extract_significand_bits();
 					auto exponent = int(br.extract_exponent_bits());
 
@@ -517,9 +660,22 @@ namespace jkj::fp {
 						exponent = min_exponent - significand_bits;
 					}
 
-					// Compute k and beta
+					// Compute k
 					int const minus_k = log::floor_log10_pow2(exponent) - kappa;
-					auto const cache = CachePolicy::template get_cache<format>(-minus_k);
+					assert(-minus_k >= cache_holder<format>::min_k &&
+						-minus_k <= cache_holder<format>::max_k);
+					return{ significand, exponent, minus_k, false };
+				}
+
+				template <class TrailingZeroPolicy, class ReturnType>
+				JKJ_FORCEINLINE static void compute_left_closed_directed_digits(ReturnType& ret_value,
+					directed_bounds const& bounds, cache_entry_type const& cache) noexcept
+				{
+					auto const significand = bounds.significand;
+					auto const exponent = bounds.exponent;
+					auto const minus_k = bounds.minus_k;
+
+					// Compute beta
 					int const beta = exponent + log::floor_log2_pow10(-minus_k) + 1;
 
 					// Compute xi and deltai
@@ -536,7 +692,6 @@ namespace jkj::fp {
 					//////////////////////////////////////////////////////////////////////
 
 					constexpr auto big_divisor = compute_power<kappa + 1>(std::uint32_t(10));
-					constexpr auto small_divisor = compute_power<kappa>(std::uint32_t(10));
 
 					// Using an upper bound on xi, we might be able to optimize the division
 					// better than the compiler; we are computing xi / big_divisor here
@@ -565,7 +720,7 @@ namespace jkj::fp {
 					// The ceiling is inside, so we are done
 					ret_value.exponent = minus_k + kappa + 1;
 					TrailingZeroPolicy::on_trailing_zeros(ret_value);
-					return ret_value;
+					return;
 
 
 					//////////////////////////////////////////////////////////////////////
@@ -577,7 +732,6 @@ namespace jkj::fp {
 					ret_value.significand -= div::small_division_by_pow10<kappa>(r);
 					ret_value.exponent = minus_k + kappa;
 					TrailingZeroPolicy::no_trailing_zeros(ret_value);
-					return ret_value;
 				}
 
 				template <class ReturnType, class SignPolicy, class TrailingZeroPolicy, class CachePolicy>
@@ -590,18 +744,28 @@ namespace jkj::fp {
 
 					ReturnType ret_value;
 
-					SignPolicy::handle_sign(br, ret_value);
+					SignPolicy::binary_to_decimal(br, ret_value);
+
+					auto const bounds = right_closed_directed_bounds(br);
+					auto const cache = CachePolicy::template get_cache<format>(-bounds.minus_k);
+					compute_right_closed_directed_digits<TrailingZeroPolicy>(ret_value, bounds, cache);
+					return ret_value;
+				}
 
+				static directed_bounds right_closed_directed_bounds(ieee754_bits<Float> const br) noexcept
+				{
 					auto significand = br.extract_significand_bits();
 					auto exponent = int(br.extract_exponent_bits());
 
 					// Deal with normal/subnormal dichotomy
 					bool closer_boundary = false;
 					if (exponent != 0) {
-						exponent += exponent_bias - significand_bits;
-						if (significand == 0) {
+						// The predecessor of the smallest normal number is subnormal,
+						// so its boundary is not closer.
+						if (significand == 0 && exponent != 1) {
 							closer_boundary = true;
 						}
+						exponent += exponent_bias - significand_bits;
 						significand |= (carrier_uint(1) << significand_bits);
 					}
 					// Subnormal case; interval is always regular
@@ -609,9 +773,23 @@ namespace jkj::fp {
 						exponent = min_exponent - significand_bits;
 					}
 
-					// Compute k and beta
+					// Compute k
 					int const minus_k = log::floor_log10_pow2(exponent - (closer_boundary ? 1 : 0)) - kappa;
-					auto const cache = CachePolicy::template get_cache<format>(-minus_k);
+					assert(-minus_k >= cache_holder<format>::min_k &&
+						-minus_k <= cache_holder<format>::max_k);
+					return{ significand, exponent, minus_k, closer_boundary };
+				}
+
+				template <class TrailingZeroPolicy, class ReturnType>
+				JKJ_FORCEINLINE static void compute_right_closed_directed_digits(ReturnType& ret_value,
+					directed_bounds const& bounds, cache_entry_type const& cache) noexcept
+				{
+					auto const significand = bounds.significand;
+					auto const exponent = bounds.exponent;
+					auto const minus_k = bounds.minus_k;
+					bool const closer_boundary = bounds.closer_boundary;
+
+					// Compute beta
 					int const beta = exponent + log::floor_log2_pow10(-minus_k) + 1;
 
 					// Compute zi and deltai
@@ -627,7 +805,6 @@ namespace jkj::fp {
 					//////////////////////////////////////////////////////////////////////
 
 					constexpr auto big_divisor = compute_power<kappa + 1>(std::uint32_t(10));
-					constexpr auto small_divisor = compute_power<kappa>(std::uint32_t(10));
 
 					// Using an upper bound on zi, we might be able to optimize the division
 					// better than the compiler; we are computing zi / big_divisor here
@@ -657,7 +834,7 @@ namespace jkj::fp {
 					// The floor is inside, so we are done
 					ret_value.exponent = minus_k + kappa + 1;
 					TrailingZeroPolicy::on_trailing_zeros(ret_value);
-					return ret_value;
+					return;
 
 
 					//////////////////////////////////////////////////////////////////////
@@ -669,9 +846,279 @@ namespace jkj::fp {
 					ret_value.significand += div::small_division_by_pow10<kappa>(r);
 					ret_value.exponent = minus_k + kappa;
 					TrailingZeroPolicy::no_trailing_zeros(ret_value);
+				}
+
+				// Computes the shortest decimal <= lower and the shortest decimal >= upper,
+				// each of which reads back to the respective bound. When both bounds need
+				// the same power of 10, the cache is loaded only once.
+				template <class ReturnType, class SignPolicy, class TrailingZeroPolicy, class CachePolicy>
+				JKJ_SAFEBUFFERS static decimal_interval<ReturnType> compute_enclosure(
+					ieee754_bits<Float> const lower, ieee754_bits<Float> const upper) noexcept
+				{
+					decimal_interval<ReturnType> ret_value;
+					SignPolicy::binary_to_decimal(lower, ret_value.lower);
+					SignPolicy::binary_to_decimal(upper, ret_value.upper);
+
+					// The decimal for a negative lower bound is not below it in magnitude,
+					// and neither is the one for a nonnegative upper bound.
+					bool const lower_is_left_closed = lower.is_negative();
+					bool const upper_is_left_closed = !upper.is_negative();
+
+					auto const lower_bounds = lower_is_left_closed ?
+						left_closed_directed_bounds(lower) : right_closed_directed_bounds(lower);
+					auto const upper_bounds = upper_is_left_closed ?
+						left_closed_directed_bounds(upper) : right_closed_directed_bounds(upper);
+
+					auto const lower_cache = CachePolicy::template get_cache<format>(-lower_bounds.minus_k);
+					auto const upper_cache = lower_bounds.minus_k == upper_bounds.minus_k ? lower_cache :
+						CachePolicy::template get_cache<format>(-upper_bounds.minus_k);
+
+					if (!lower.is_nonzero()) {
+						ret_value.lower.significand = 0;
+						ret_value.lower.exponent = 0;
+						TrailingZeroPolicy::no_trailing_zeros(ret_value.lower);
+					}
+					else if (lower_is_left_closed) {
+						compute_left_closed_directed_digits<TrailingZeroPolicy>(ret_value.lower,
+							lower_bounds, lower_cache);
+					}
+					else {
+						compute_right_closed_directed_digits<TrailingZeroPolicy>(ret_value.lower,
+							lower_bounds, lower_cache);
+					}
+
+					if (!upper.is_nonzero()) {
+						ret_value.upper.significand = 0;
+						ret_value.upper.exponent = 0;
+						TrailingZeroPolicy::no_trailing_zeros(ret_value.upper);
+					}
+					else if (upper_is_left_closed) {
+						compute_left_closed_directed_digits<TrailingZeroPolicy>(ret_value.upper,
+							upper_bounds, upper_cache);
+					}
+					else {
+						compute_right_closed_directed_digits<TrailingZeroPolicy>(ret_value.upper,
+							upper_bounds, upper_cache);
+					}
+					return ret_value;
+				}
+
+				// Finds the shortest decimal in [x - tolerance, x + tolerance], and among
+				// those, the closest one to x.
+				// The interval is (2fc - m) * 2^(e-1) to (2fc + m) * 2^(e-1), where the tolerance
+				// is rounded down to m * 2^(e-1), so the computation proceeds like
+				// the nearest case with a wider interval.
+				template <class ReturnType, class SignPolicy, class TrailingZeroPolicy,
+					class DecimalRoundingPolicy, class CachePolicy>
+				JKJ_SAFEBUFFERS static ReturnType compute_within(ieee754_bits<Float> const br,
+					ieee754_bits<Float> const tolerance) noexcept
+				{
+					ReturnType ret_value;
+
+					// Zero is in the interval.
+					constexpr auto magnitude_mask = ~ieee754_traits<Float>::negative_zero();
+					if ((tolerance.u & magnitude_mask) >= (br.u & magnitude_mask)) {
+						SignPolicy::binary_to_decimal(br, ret_value);
+						ret_value.significand = 0;
+						ret_value.exponent = 0;
+						TrailingZeroPolicy::no_trailing_zeros(ret_value);
+						return ret_value;
+					}
+
+					auto significand = br.extract_significand_bits();
+					auto exponent = int(br.extract_exponent_bits());
+					if (exponent != 0) {
+						exponent += exponent_bias - significand_bits;
+						significand |= (carrier_uint(1) << significand_bits);
+					}
+					else {
+						exponent = min_exponent - significand_bits;
+					}
+
+					auto tolerance_significand = tolerance.extract_significand_bits();
+					auto tolerance_exponent = int(tolerance.extract_exponent_bits());
+					if (tolerance_exponent != 0) {
+						tolerance_exponent += exponent_bias - significand_bits;
+						tolerance_significand |= (carrier_uint(1) << significand_bits);
+					}
+					else {
+						tolerance_exponent = min_exponent - significand_bits;
+					}
+
+					// Since tolerance < |x|, m < 2fc.
+					int const shift = tolerance_exponent - (exponent - 1);
+					carrier_uint const m = shift >= 0 ? carrier_uint(tolerance_significand << shift) :
+						-shift < int(carrier_bits) ? carrier_uint(tolerance_significand >> -shift) :
+						carrier_uint(0);
+
+					// A tolerance of at least half an ulp covers the roundtrip interval.
+					// Anything less is rounded down to zero, and then the result
+					// might not fit in the significand.
+					assert(m >= 1);
+					if (m == 1) {
+						return compute_nearest<ReturnType, policy::binary_rounding::nearest_to_even,
+							SignPolicy, TrailingZeroPolicy, DecimalRoundingPolicy, CachePolicy>(br);
+					}
+
+					SignPolicy::binary_to_decimal(br, ret_value);
+
+					// Compute k and beta as in the nearest case
+					int const minus_k = log::floor_log10_pow2(exponent) - kappa;
+					auto const cache = CachePolicy::template get_cache<format>(-minus_k);
+					int const beta_minus_1 = exponent + log::floor_log2_pow10(-minus_k);
+
+					// Compute xi, zi, and the scaled x; an endpoint that cannot be decided
+					// is moved inward.
+					carrier_uint const two_fc = significand << 1;
+					auto const lower = compute_mul_within(two_fc - m, exponent, minus_k,
+						cache, beta_minus_1);
+					auto const upper = compute_mul_within(two_fc + m, exponent, minus_k,
+						cache, beta_minus_1);
+					auto const center = compute_mul_within(two_fc, exponent, minus_k,
+						cache, beta_minus_1);
+
+					carrier_uint const xi = lower.is_integer ? lower.min_floor : lower.max_floor + 1;
+					carrier_uint const zi = upper.min_floor;
+					assert(xi <= zi);
+
+					constexpr int max_power = std::numeric_limits<carrier_uint>::digits10;
+					constexpr auto const& pow10 = pow_table<carrier_uint, 10, max_power + 1>::table;
+
+					// Find u such that 10^u <= zi < 10^(u+1).
+					int u = log::floor_log10_pow2(int(carrier_bits) - 1 - bits::countl_zero(zi));
+					if (u < max_power && pow10[u + 1] <= zi) {
+						++u;
+					}
+					assert(u >= 1);
+
+					int t;
+					bool may_have_trailing_zeros;
+					if (xi <= pow10[u]) {
+						// The interval contains 10^u, so the result has only one digit.
+						// Those above x are multiples of 10^u, and those below x are
+						// multiples of 10^(u-1).
+						t = center.min_floor >= pow10[u] ? u : u - 1;
+						may_have_trailing_zeros = true;
+					}
+					else {
+						// Find t such that 10^t <= zi - xi + 1 < 10^(t+1); then [xi, zi] contains
+						// a multiple of 10^t and at most one multiple of 10^(t+1).
+						auto const width = carrier_uint(zi - xi + 1);
+						t = log::floor_log10_pow2(int(carrier_bits) - 1 - bits::countl_zero(width));
+						if (t < u && pow10[t + 1] <= width) {
+							++t;
+						}
+						assert(t >= 1 && t <= u);
+
+						// Try the bigger divisor; there can be trailing zeros
+						if (t < u) {
+							auto const big_divisor = pow10[t + 1];
+							ret_value.significand = zi / big_divisor;
+							if (ret_value.significand * big_divisor >= xi) {
+								ret_value.exponent = minus_k + t + 1;
+								TrailingZeroPolicy::on_trailing_zeros(ret_value);
+								return ret_value;
+							}
+						}
+						may_have_trailing_zeros = false;
+					}
+
+					// Take the multiple of 10^t closest to x
+					auto const divisor = pow10[t];
+					auto const min_significand = carrier_uint((xi + divisor - 1) / divisor);
+					auto const max_significand = carrier_uint(zi / divisor);
+					auto const rounded = carrier_uint((center.min_floor + divisor / 2) / divisor);
+					bool const is_tie = center.is_integer &&
+						rounded * divisor - divisor / 2 == center.min_floor;
+
+					ret_value.exponent = minus_k + t;
+					if (rounded > max_significand) {
+						ret_value.significand = max_significand;
+					}
+					else if (rounded < min_significand) {
+						ret_value.significand = min_significand;
+					}
+					else {
+						ret_value.significand = rounded;
+						if (is_tie && rounded > min_significand) {
+							DecimalRoundingPolicy::break_rounding_tie(ret_value);
+						}
+					}
+					if (may_have_trailing_zeros) {
+						TrailingZeroPolicy::on_trailing_zeros(ret_value);
+					}
+					else {
+						TrailingZeroPolicy::no_trailing_zeros(ret_value);
+					}
 					return ret_value;
 				}
 
+				// floor(w * 2^(e-1) * 10^k) computed from the cache, where
+				// w < 2^(significand_bits + 3). As the cache is not exact, when the
+				// fractional part is too close to an integer, the floor is one of
+				// min_floor and max_floor unless the product is an integer.
+				struct within_product {
+					carrier_uint min_floor;
+					carrier_uint max_floor;
+					bool is_integer;
+				};
+
+				static within_product compute_mul_within(carrier_uint w, int exponent, int minus_k,
+					cache_entry_type const& cache, int beta_minus_1) noexcept
+				{
+					constexpr int max_beta_minus_1 = log::floor_log2_pow10(kappa + 1);
+					assert(beta_minus_1 >= 0 && beta_minus_1 <= max_beta_minus_1);
+
+					// Upper 128 bits of w * cache, so that w << beta_minus_1 can be wider
+					// than the carrier type.
+					wuint::uint128 product;
+					if constexpr (format == ieee754_format::binary32) {
+						product = wuint::umul128(std::uint64_t(w), cache);
+					}
+					else {
+						product = wuint::umul192_upper128(w, cache);
+					}
+					auto const integer_part = carrier_uint(beta_minus_1 == 0 ? product.high() :
+						(product.high() << beta_minus_1) | (product.low() >> (64 - beta_minus_1)));
+					auto const fractional_part = product.low() << beta_minus_1;
+
+					// Bound on the error of the fractional part, in units of 2^-64.
+					// The error of the cache contributes less than w * 2^(beta-1-cache_bits+64),
+					// and for binary64, dropping the lowest 64 bits of the product contributes
+					// less than 2^(beta-1).
+					constexpr int error_bits = 1 + (format == ieee754_format::binary32 ?
+						significand_bits + 3 + max_beta_minus_1 - cache_bits + 64 :
+						max_beta_minus_1);
+					static_assert(error_bits >= 0 && error_bits < 63);
+					constexpr auto margin = std::uint64_t(1) << error_bits;
+
+					if (fractional_part >= margin && fractional_part <= ~margin) {
+						return{ integer_part, integer_part, false };
+					}
+					if (is_product_integer_within(w, exponent, minus_k)) {
+						auto const n = fractional_part < margin ? integer_part : carrier_uint(integer_part + 1);
+						return{ n, n, true };
+					}
+					if (fractional_part < margin) {
+						return{ integer_part == 0 ? integer_part : carrier_uint(integer_part - 1),
+							integer_part, false };
+					}
+					return{ integer_part, carrier_uint(integer_part + 1), false };
+				}
+
+				// Is w * 2^(e-1) * 10^k an integer?
+				static bool is_product_integer_within(carrier_uint w, int exponent, int minus_k) noexcept
+				{
+					constexpr int max_power_of_5 = log::floor_log5_pow2(significand_bits + 3);
+					if (minus_k > 0 && (minus_k > max_power_of_5 ||
+						!div::divisible_by_power_of_5<max_power_of_5 + 1>(w, unsigned(minus_k))))
+					{
+						return false;
+					}
+					int const power_of_2 = exponent - 1 - minus_k;
+					return power_of_2 >= 0 || div::divisible_by_power_of_2(w, unsigned(-power_of_2));
+				}
+
 				// Remove trailing zeros from n and return the number of zeros removed
 				JKJ_FORCEINLINE static int remove_trailing_zeros(carrier_uint& n) noexcept {
 					constexpr auto max_power = [] {
@@ -896,6 +1343,85 @@ namespace jkj::fp {
 					fc_pm_half,
 					fc
 				};
+
+				// Parameters of the divisibility checks is_product_integer performs for
+				// each exponent, assuming minus_k == floor_log10_pow2(exponent) - kappa
+				// and two_f < 2^(significand_bits + 2). The product is an integer if and only
+				// if two_f is divisible by 2^power_of_2 and by 5^power_of_5; it is never an
+				// integer for the exponents outside the table.
+				template <integer_check_case_id case_id>
+				struct integer_check_table {
+					struct entry_t {
+						std::uint8_t power_of_2;
+						std::uint8_t power_of_5;
+					};
+
+					static constexpr int min_exponent = [] {
+						if constexpr (case_id == integer_check_case_id::fc_pm_half) {
+							return case_fc_pm_half_lower_threshold;
+						}
+						else {
+							// The smallest exponent such that two_f can be divisible by the power of 2
+							int e = case_fc_lower_threshold;
+							while (log::floor_log10_pow2(e - 1) - kappa - (e - 1) + 1 <=
+								significand_bits + 1)
+							{
+								--e;
+							}
+							return e;
+						}
+					}();
+					static constexpr int max_exponent = divisibility_check_by_5_threshold;
+					static constexpr std::size_t size = std::size_t(max_exponent - min_exponent + 1);
+
+					entry_t entries[size];
+				};
+
+				template <integer_check_case_id case_id>
+				static constexpr integer_check_table<case_id> integer_check_table_v = [] {
+					using table_t = integer_check_table<case_id>;
+					table_t table{};
+					for (int exponent = table_t::min_exponent; exponent <= table_t::max_exponent;
+						++exponent)
+					{
+						int const minus_k = log::floor_log10_pow2(exponent) - kappa;
+						auto& entry = table.entries[std::size_t(exponent - table_t::min_exponent)];
+						entry.power_of_2 = 0;
+						entry.power_of_5 = 0;
+
+						if constexpr (case_id == integer_check_case_id::fc_pm_half) {
+							if (exponent > case_fc_pm_half_upper_threshold) {
+								entry.power_of_5 = std::uint8_t(minus_k);
+							}
+						}
+						else {
+							if (exponent > case_fc_upper_threshold) {
+								entry.power_of_5 = std::uint8_t(minus_k);
+							}
+							else if (exponent < case_fc_lower_threshold) {
+								entry.power_of_2 = std::uint8_t(minus_k - exponent + 1);
+							}
+						}
+					}
+					return table;
+				}();
+
+				// Same as below, for minus_k == floor_log10_pow2(exponent) - kappa.
+				template <integer_check_case_id case_id>
+				static bool is_product_integer(carrier_uint two_f, int exponent) noexcept
+				{
+					using table_t = integer_check_table<case_id>;
+					auto const idx = unsigned(exponent - table_t::min_exponent);
+					if (idx >= table_t::size) {
+						return false;
+					}
+
+					auto const& entry = integer_check_table_v<case_id>.entries[idx];
+					auto const mask = (carrier_uint(1) << entry.power_of_2) - 1;
+					return ((two_f & mask) == 0) &
+						div::divisible_by_power_of_5<max_power_of_factor_of_5 + 1>(two_f, entry.power_of_5);
+				}
+
 				template <integer_check_case_id case_id>
 				static bool is_product_integer(carrier_uint two_f, int exponent, int minus_k) noexcept
 				{
@@ -961,7 +1487,9 @@ namespace jkj::fp {
 				make_default<policy_kind::binary_rounding>(binary_rounding::nearest_to_even),
 				make_default<policy_kind::decimal_rounding>(decimal_rounding::to_even),
 				make_default<policy_kind::cache>(cache::fast),
-				make_default<policy_kind::input_validation>(input_validation::assert_finite)),
+				make_default<policy_kind::input_validation>(input_validation::assert_finite),
+				make_default<policy_kind::integer_check>(integer_check::do_nothing),
+				make_default<policy_kind::branch_strategy>(branch_strategy::branchy)),
 			std::forward<Policies>(policies)...);
 
 		using policy_holder_t = decltype(policy_holder);
@@ -971,39 +1499,184 @@ namespace jkj::fp {
 			decltype(policy_holder)::report_trailing_zeros>;
 
 		auto br = ieee754_bits(x);
-		policy_holder.validate_input(br);
 
-		return policy_holder.delegate(br,
-			[br](auto interval_type_provider) {
-				using detail::policy::binary_rounding::tag_t;
-				constexpr tag_t tag = decltype(interval_type_provider)::tag;
-
-				if constexpr (tag == tag_t::to_nearest) {
-					return detail::dragonbox::impl<Float>::template
-						compute_nearest<return_type, decltype(interval_type_provider),
-							typename policy_holder_t::sign_policy,
-							typename policy_holder_t::trailing_zero_policy,
-							typename policy_holder_t::decimal_rounding_policy,
-							typename policy_holder_t::cache_policy
-						>(br);
-				}
-				else if constexpr (tag == tag_t::left_closed_directed) {
-					return detail::dragonbox::impl<Float>::template
-						compute_left_closed_directed<return_type,
-							typename policy_holder_t::sign_policy,
-							typename policy_holder_t::trailing_zero_policy,
-							typename policy_holder_t::cache_policy
-						>(br);
+		auto compute = [br, &policy_holder]() {
+			if constexpr (policy_holder_t::check_integers) {
+				return_type ret_value;
+				if (detail::dragonbox::impl<Float>::template compute_integer<
+					typename policy_holder_t::sign_policy,
+					typename policy_holder_t::trailing_zero_policy>(br, ret_value))
+				{
+					return ret_value;
 				}
-				else {
-					return detail::dragonbox::impl<Float>::template
-						compute_right_closed_directed<return_type,
-							typename policy_holder_t::sign_policy,
-							typename policy_holder_t::trailing_zero_policy,
-							typename policy_holder_t::cache_policy
-						>(br);
+			}
+
+			return policy_holder.delegate(br,
+				[br](auto interval_type_provider) {
+					using detail::policy::binary_rounding::tag_t;
+					constexpr tag_t tag = decltype(interval_type_provider)::tag;
+
+					if constexpr (tag == tag_t::to_nearest) {
+						return detail::dragonbox::impl<Float>::template
+							compute_nearest<return_type, decltype(interval_type_provider),
+								typename policy_holder_t::sign_policy,
+								typename policy_holder_t::trailing_zero_policy,
+								typename policy_holder_t::decimal_rounding_policy,
+								typename policy_holder_t::cache_policy,
+								typename policy_holder_t::branch_strategy_policy
+							>(br);
+					}
+					else if constexpr (tag == tag_t::left_closed_directed) {
+						return detail::dragonbox::impl<Float>::template
+							compute_left_closed_directed<return_type,
+								typename policy_holder_t::sign_policy,
+								typename policy_holder_t::trailing_zero_policy,
+								typename policy_holder_t::cache_policy
+							>(br);
+					}
+					else {
+						return detail::dragonbox::impl<Float>::template
+							compute_right_closed_directed<return_type,
+								typename policy_holder_t::sign_policy,
+								typename policy_holder_t::trailing_zero_policy,
+								typename policy_holder_t::cache_policy
+							>(br);
+					}
+				});
+		};
+
+		if constexpr (policy_holder_t::returns_value_class) {
+			// Zeros, infinities and NaN's are reported with the sign and no digits.
+			classified_decimal_fp<return_type> ret_value;
+			ret_value.classification =
+				policy_holder_t::input_validation_policy::classify_input(br);
+			if (ret_value.classification != value_class::finite) {
+				ret_value.significand = 0;
+				ret_value.exponent = 0;
+				if constexpr (policy_holder_t::report_trailing_zeros) {
+					ret_value.may_have_trailing_zeros = false;
 				}
-			});
+				policy_holder_t::sign_policy::binary_to_decimal(br, ret_value);
+				return ret_value;
+			}
+			static_cast<return_type&>(ret_value) = compute();
+			return ret_value;
+		}
+		else {
+			policy_holder.validate_input(br);
+			return compute();
+		}
+	}
+
+	// Finds the shortest decimal <= lower and the shortest decimal >= upper, where each of them
+	// reads back to the respective bound when rounded inward, that is, the same as
+	// to_shortest_decimal with binary_rounding::toward_plus_infinity for lower and with
+	// binary_rounding::toward_minus_infinity for upper, done in one call.
+	template <class Float, class... Policies>
+	JKJ_SAFEBUFFERS JKJ_FORCEINLINE auto to_shortest_decimal_enclosure(Float lower, Float upper,
+		Policies&&... policies)
+	{
+		// Build policy holder type
+		using namespace policy;
+		using detail::policy::make_policy_holder;
+		using detail::policy::make_default_list;
+		using detail::policy::make_default;
+		auto policy_holder = make_policy_holder(
+			make_default_list(
+				make_default<policy_kind::sign>(sign::propagate),
+				make_default<policy_kind::trailing_zero>(trailing_zero::remove),
+				make_default<policy_kind::cache>(cache::fast),
+				make_default<policy_kind::input_validation>(input_validation::assert_finite)),
+			std::forward<Policies>(policies)...);
+
+		using policy_holder_t = decltype(policy_holder);
+
+		using return_type = decimal_fp<Float,
+			decltype(policy_holder)::return_has_sign,
+			decltype(policy_holder)::report_trailing_zeros>;
+
+		static_assert(!policy_holder_t::returns_value_class,
+			"jkj::fp::policy::input_validation::classify is only valid for to_shortest_decimal");
+
+		auto lower_br = ieee754_bits(lower);
+		auto upper_br = ieee754_bits(upper);
+		policy_holder.validate_input(lower_br);
+		policy_holder.validate_input(upper_br);
+		assert(lower <= upper);
+
+		return detail::dragonbox::impl<Float>::template
+			compute_enclosure<return_type,
+				typename policy_holder_t::sign_policy,
+				typename policy_holder_t::trailing_zero_policy,
+				typename policy_holder_t::cache_policy
+			>(lower_br, upper_br);
+	}
+
+	// Finds the shortest decimal within the given absolute tolerance of x, that is, the one
+	// with the fewest digits in [x - tolerance, x + tolerance]. Among those, the one
+	// closest to x is chosen, and ties are broken according to the decimal rounding policy.
+	// The result is zero if tolerance >= |x|; otherwise, the tolerance should be at least
+	// half the ulp of x. The tolerance is rounded down to a multiple of half the ulp of x,
+	// and tolerances less than one ulp give the same result as to_shortest_decimal.
+	template <class Float, class... Policies>
+	JKJ_SAFEBUFFERS JKJ_FORCEINLINE auto to_shortest_decimal_within(Float x, Float tolerance,
+		Policies&&... policies)
+	{
+		// Build policy holder type
+		using namespace policy;
+		using detail::policy::make_policy_holder;
+		using detail::policy::make_default_list;
+		using detail::policy::make_default;
+		auto policy_holder = make_policy_holder(
+			make_default_list(
+				make_default<policy_kind::sign>(sign::propagate),
+				make_default<policy_kind::trailing_zero>(trailing_zero::remove),
+				make_default<policy_kind::decimal_rounding>(decimal_rounding::to_even),
+				make_default<policy_kind::cache>(cache::fast),
+				make_default<policy_kind::input_validation>(input_validation::assert_finite)),
+			std::forward<Policies>(policies)...);
+
+		using policy_holder_t = decltype(policy_holder);
+
+		using return_type = decimal_fp<Float,
+			decltype(policy_holder)::return_has_sign,
+			decltype(policy_holder)::report_trailing_zeros>;
+
+		static_assert(!policy_holder_t::returns_value_class,
+			"jkj::fp::policy::input_validation::classify is only valid for to_shortest_decimal");
+
+		auto br = ieee754_bits(x);
+		policy_holder.validate_input(br);
+
+		auto tolerance_br = ieee754_bits(tolerance);
+		assert(tolerance_br.is_finite() && !tolerance_br.is_negative());
+
+		return detail::dragonbox::impl<Float>::template
+			compute_within<return_type,
+				typename policy_holder_t::sign_policy,
+				typename policy_holder_t::trailing_zero_policy,
+				typename policy_holder_t::decimal_rounding_policy,
+				typename policy_holder_t::cache_policy
+			>(br, tolerance_br);
+	}
+
+	// Same as to_shortest_decimal_within, with the tolerance relative_tolerance * |x|
+	// rounded down.
+	template <class Float, class... Policies>
+	JKJ_SAFEBUFFERS JKJ_FORCEINLINE auto to_shortest_decimal_within_relative(Float x,
+		Float relative_tolerance, Policies&&... policies)
+	{
+		assert(relative_tolerance >= 0);
+		auto const magnitude = std::abs(x);
+		auto tolerance = ieee754_bits<Float>{ Float(relative_tolerance * magnitude) };
+
+		// The product is rounded to nearest; step down if it was rounded up.
+		// An underflowing negative difference still has the sign bit set.
+		if (std::signbit(std::fma(relative_tolerance, magnitude, -tolerance.to_float()))) {
+			--tolerance.u;
+		}
+		return to_shortest_decimal_within(x, tolerance.to_float(),
+			std::forward<Policies>(policies)...);
 	}
 }
 
@@ -21,24 +21,177 @@
 #include "../dooly.h"
 #include "../ryu_printf.h"
 #include "../to_chars/to_chars_common.h"
+#include "from_chars_common.h"
 #include <cassert>
+#include <limits>
+#include <utility>
 
 namespace jkj::fp {
-	// This function is VERY primitive; it does not offer any proper parse error checking,
-	// and it might even accept some malformed inputs.
 	template <class Float>
-	ieee754_bits<Float> from_chars_limited(char const* begin, char const* end)
+	struct parse_decimal_result {
+		// The input is (decimal.significand + tail) * 10^decimal.exponent, where tail is in [0,1).
+		signed_decimal_fp<Float> decimal;
+		// The number of significant digits, including the ones not in decimal.significand.
+		// Leading zeros are not counted, but trailing zeros are.
+		int digits;
+		// Some significant digits did not fit into decimal.significand and were dropped.
+		bool is_truncated;
+		// Some of the dropped digits are nonzero, i.e., tail is nonzero.
+		bool has_nonzero_tail;
+		// The exponent was too large in magnitude and saturated.
+		bool has_exponent_overflow;
+		// One past the last character parsed.
+		char const* ptr;
+	};
+
+	// Reads a decimal number without converting it into binary.
+	// At most as many digits as always fit into the carrier are stored into the significand;
+	// the remaining digits are dropped, and only whether they are all zero is remembered.
+	// Parsing stops at the first character that cannot continue the number.
+	// As other functions in this file, this function is VERY primitive; it does not offer
+	// any proper parse error checking, and it might even accept some malformed inputs.
+	// The decimal point, the group separator and the exponent part are specified by Format;
+	// see parse_format.
+	template <class Float, class Format = default_parse_format>
+	parse_decimal_result<Float> parse_decimal(char const* first, char const* last) noexcept
 	{
 		using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
+		constexpr int max_digits = std::numeric_limits<carrier_uint>::digits10;
+		constexpr int max_exponent_magnitude = 1 << 26;
+
+		assert(first != last);
+
+		parse_decimal_result<Float> result;
+		result.decimal.significand = 0;
+		result.decimal.exponent = 0;
+		result.decimal.is_negative = false;
+		result.is_truncated = false;
+		result.has_nonzero_tail = false;
+		result.has_exponent_overflow = false;
+
+		if (*first == '-') {
+			result.decimal.is_negative = true;
+			++first;
+			assert(first != last);
+		}
+		else if (*first == '+') {
+			++first;
+			assert(first != last);
+		}
+
+		// Skip leading zeros.
+		bool decimal_dot_found = false;
+		detail::digit_group_reader<Format> integer_part_reader{ false };
+		detail::digit_group_reader<Format> fractional_part_reader{ true };
+		{
+			int zeros = 0;
+			first = integer_part_reader.skip_zeros(first, last, zeros);
+		}
+		if (first != last && *first == Format::decimal_point) {
+			decimal_dot_found = true;
+			++first;
+			int zeros = 0;
+			first = fractional_part_reader.skip_zeros(first, last, zeros);
+			result.decimal.exponent -= zeros;
+		}
+
+		// Read the first significant digits.
+		int digits = 0;
+		if (decimal_dot_found) {
+			first = fractional_part_reader.accumulate(first, last, result.decimal.significand,
+				digits, max_digits);
+			result.decimal.exponent -= digits;
+		}
+		else {
+			first = integer_part_reader.accumulate(first, last, result.decimal.significand,
+				digits, max_digits);
+			if (first != last && *first == Format::decimal_point) {
+				decimal_dot_found = true;
+				++first;
+				int fractional_digits = 0;
+				first = fractional_part_reader.accumulate(first, last,
+					result.decimal.significand, fractional_digits, max_digits - digits);
+				result.decimal.exponent -= fractional_digits;
+				digits += fractional_digits;
+			}
+		}
+
+		// Drop the remaining digits, which are only possible if the significand is full.
+		// The first nonzero digit, if any, stops skip_zeros, and then skip counts at least
+		// one digit.
+		int dropped_digits = 0;
+		if (digits == max_digits) {
+			if (!decimal_dot_found) {
+				int nonzero_digits = 0;
+				first = integer_part_reader.skip_zeros(first, last, dropped_digits);
+				first = integer_part_reader.skip(first, last, nonzero_digits);
+				result.has_nonzero_tail = nonzero_digits != 0;
+				dropped_digits += nonzero_digits;
+				result.decimal.exponent += dropped_digits;
+				if (first != last && *first == Format::decimal_point) {
+					decimal_dot_found = true;
+					++first;
+				}
+			}
+			if (decimal_dot_found) {
+				int nonzero_digits = 0;
+				first = fractional_part_reader.skip_zeros(first, last, dropped_digits);
+				first = fractional_part_reader.skip(first, last, nonzero_digits);
+				result.has_nonzero_tail |= nonzero_digits != 0;
+				dropped_digits += nonzero_digits;
+			}
+		}
+		fractional_part_reader.finish();
+		integer_part_reader.finish();
+		result.digits = digits + dropped_digits;
+		result.is_truncated = dropped_digits != 0;
+
+		// Read the exponent; a dangling e is not a part of the number.
+		result.ptr = first;
+		if (first != last && (*first == 'e' || *first == 'E')) {
+			++first;
+			bool is_negative_exponent = false;
+			if (first != last && (*first == '-' || *first == '+')) {
+				is_negative_exponent = *first == '-';
+				++first;
+			}
+			if (first != last && detail::is_decimal_digit(*first)) {
+				int exp = 0;
+				for (; first != last && detail::is_decimal_digit(*first); ++first) {
+					if (exp < max_exponent_magnitude) {
+						exp = exp * 10 + (*first - '0');
+					}
+				}
+				if (exp >= max_exponent_magnitude) {
+					result.has_exponent_overflow = true;
+				}
+				result.decimal.exponent += is_negative_exponent ? -exp : exp;
+				result.ptr = first;
+				return result;
+			}
+		}
+		assert(Format::exponent == exponent_part::optional);
+		return result;
+	}
+
+	// This function is VERY primitive; it does not offer any proper parse error checking,
+	// and it might even accept some malformed inputs.
+	// The decimal point, the group separator and the exponent part are specified by Format;
+	// see parse_format. The policies are passed to to_binary_limited_precision.
+	template <class Float, class Format = default_parse_format, class... Policies>
+	ieee754_bits<Float> from_chars_limited(char const* begin, char const* end,
+		Policies&&... policies)
+	{
+		// Every digit should fit in the carrier type.
 		[[maybe_unused]] constexpr auto digit_limit =
-			jkj::fp::to_binary_limited_precision_digit_limit<jkj::fp::ieee754_traits<Float>::format>;
+			std::numeric_limits<typename ieee754_traits<Float>::carrier_uint>::digits10;
 
 		assert(begin != end);
 
 		jkj::fp::signed_decimal_fp<Float> decimal;
+		decimal.significand = 0;
 		decimal.exponent = 0;
 		int digits = 0;
-		char const* next_to_decimal_dot_pos;
 		if (*begin == '-') {
 			decimal.is_negative = true;
 			++begin;
@@ -52,74 +205,49 @@ namespace jkj::fp {
 			}
 		}
 
-		if (*begin == '.') {
-			next_to_decimal_dot_pos = ++begin;
+		if (*begin == Format::decimal_point) {
+			++begin;
 			assert(begin != end);
-			decimal.significand = 0;
 			goto after_decimal_point_label;
 		}
-		else if (*begin == '0') {
+		else {
+			assert(detail::is_decimal_digit(*begin));
+			// Leading zeros are not counted.
+			detail::digit_group_reader<Format> reader{ false };
+			int zeros = 0;
+			begin = reader.skip_zeros(begin, end, zeros);
+			begin = reader.accumulate(begin, end, decimal.significand, digits);
+			reader.finish();
+			assert(digits <= digit_limit);
+		}
+		if (begin == end) {
+			goto convert_to_binary_label;
+		}
+		else if (*begin == Format::decimal_point) {
 			++begin;
-			decimal.significand = 0;
-			if (begin == end) {
-				goto convert_to_binary_label;
-			}
-			else if (*begin == '.') {
-				next_to_decimal_dot_pos = ++begin;
-				goto after_decimal_point_label;
-			}
-			else if (*begin == 'e' || *begin == 'E') {
-				++begin;
-				goto after_e_label;
-			}
-			else {
-				// Should not reach here.
-				assert(false);
-			}
+			goto after_decimal_point_label;
 		}
 		else {
-			assert(*begin >= '1' && *begin <= '9');
-			digits = 1;
-			decimal.significand = carrier_uint(*begin - '0');
+			assert(*begin == 'e' || *begin == 'E');
 			++begin;
+			goto after_e_label;
 		}
 
-		for (; begin != end; ++begin) {
-			if (*begin == '.') {
-				next_to_decimal_dot_pos = ++begin;
-				goto after_decimal_point_label;
-			}
-			else if (*begin == 'e' || *begin == 'E') {
-				++begin;
-				goto after_e_label;
-			}
-			else {
-				assert(*begin >= '0' && *begin <= '9');
-				++digits;
-				assert(digits <= digit_limit);
-				decimal.significand *= 10;
-				decimal.significand += carrier_uint(*begin - '0');
-			}
-		}
-		goto convert_to_binary_label;
-
 	after_decimal_point_label:
-		for (; begin != end; ++begin) {
-			if (*begin == 'e' || *begin == 'E') {
-				decimal.exponent -= int(begin - next_to_decimal_dot_pos);
-				++begin;
-				goto after_e_label;
-			}
-			else {
-				assert(*begin >= '0' && *begin <= '9');
-				++digits;
-				assert(digits <= digit_limit);
-				decimal.significand *= 10;
-				decimal.significand += carrier_uint(*begin - '0');
-			}
+		{
+			detail::digit_group_reader<Format> reader{ true };
+			int fractional_digits = 0;
+			begin = reader.accumulate(begin, end, decimal.significand, fractional_digits);
+			reader.finish();
+			digits += fractional_digits;
+			assert(digits <= digit_limit);
+			decimal.exponent -= fractional_digits;
+		}
+		if (begin == end) {
+			goto convert_to_binary_label;
 		}
-		decimal.exponent -= int(begin - next_to_decimal_dot_pos);
-		goto convert_to_binary_label;
+		assert(*begin == 'e' || *begin == 'E');
+		++begin;
 
 	after_e_label:
 		{
@@ -147,270 +275,237 @@ namespace jkj::fp {
 			else {
 				decimal.exponent += exp;
 			}
+			return to_binary_limited_precision(decimal, std::forward<Policies>(policies)...);
 		}
 
 	convert_to_binary_label:
-		return to_binary_limited_precision(decimal);
+		assert(Format::exponent == exponent_part::optional);
+		return to_binary_limited_precision(decimal, std::forward<Policies>(policies)...);
+	}
+
+	namespace detail {
+		// Common routines for from_chars_unlimited and from_chars_stream.
+		// The input is given as (significand) * 10^(exponent), where significand consists of
+		// the first digits (at most extended_digit_limit) of the input.
+		// IntervalTypeProvider is what the binary rounding policy delegates to.
+		template <class Float,
+			class IntervalTypeProvider = policy::binary_rounding::nearest_to_even,
+			class CachePolicy = policy::cache::fast>
+		struct from_chars_unlimited_impl {
+			using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
+			static constexpr auto digit_limit =
+				to_binary_limited_precision_digit_limit<ieee754_traits<Float>::format>;
+			// The number of digits we read into a 64-bit integer.
+			static constexpr int extended_digit_limit = 19;
+			static_assert(digit_limit < extended_digit_limit);
+
+			static ieee754_bits<Float> compute_limited(bool is_negative,
+				std::uint64_t significand, int exponent) noexcept
+			{
+				return dooly::impl<Float>::template compute<IntervalTypeProvider,
+					policy::sign::propagate, CachePolicy>(signed_decimal_fp<Float>{
+						carrier_uint(significand), exponent, is_negative });
+			}
+
+			// Returns false if the result cannot be decided without looking at all digits.
+			static bool compute_fast(bool is_negative, std::uint64_t significand, int digits,
+				int exponent, bool has_more_digits, ieee754_bits<Float>& result) noexcept
+			{
+				// All digits fit in the limited-precision conversion.
+				if (!has_more_digits && digits <= std::numeric_limits<carrier_uint>::digits10) {
+					result = compute_limited(is_negative, significand, exponent);
+					return true;
+				}
+
+				// Try to decide the result from the digits read, by checking if
+				// the interval spanned by all possible remaining digits contains no boundary.
+				// Only inputs very close to a boundary go further.
+				result.u = 0;
+				if (dooly::impl<Float>::template compute_truncated<IntervalTypeProvider,
+					CachePolicy>(significand, exponent, result))
+				{
+					if (is_negative) {
+						result.u |= ieee754_traits<Float>::negative_zero();
+					}
+					return true;
+				}
+				return false;
+			}
+
+			// [first, last) should consist of all significant digits of the input,
+			// possibly with a decimal point and group separators between them.
+			static ieee754_bits<Float> compute_slow(bool is_negative, std::uint64_t significand,
+				int digits, int exponent, char const* first, char const* last) noexcept
+			{
+				// Compute the initial guess from the first digit_limit digits.
+				assert(digits > digit_limit);
+				constexpr auto const& pow10 =
+					pow_table<std::uint64_t, 10, extended_digit_limit - digit_limit + 1>::table;
+				significand /= pow10[digits - digit_limit];
+				exponent += digits - digit_limit;
+
+				// Compare all the digits with the boundary point.
+				char_digit_reader reader{ first, last };
+				return dooly::impl<Float>::template round_by_digit_comparison<
+					IntervalTypeProvider>(compute_limited(is_negative, significand, exponent),
+						exponent, reader);
+			}
+
+			struct char_digit_reader {
+				char const* first;
+				char const* last;
+
+				bool empty() const noexcept {
+					return first == last;
+				}
+
+				std::uint32_t read(int count) noexcept {
+					return read_segment(first, last, count);
+				}
+			};
+		};
 	}
 
 	// This function is VERY primitive; it does not offer any proper parse error checking,
 	// and it might even accept some malformed inputs.
-	template <class Float>
-	ieee754_bits<Float> from_chars_unlimited(char const* begin, char const* end)
+	// The input is read in a single forward pass; only the position of the first significant
+	// digit is remembered, and it is revisited only for inputs very close to a boundary.
+	// The decimal point, the group separator and the exponent part are specified by Format;
+	// see parse_format. The sign, binary rounding and cache policies are supported,
+	// as for to_binary_limited_precision.
+	template <class Float, class Format = default_parse_format, class... Policies>
+	ieee754_bits<Float> from_chars_unlimited(char const* begin, char const* end,
+		Policies&&...)
 	{
-		char const* decimal_dot_pos = end;
-		char const* significand_end_pos = end;
-		bool is_negative;
-		int exponent = 0;
+		using policy_holder_t = decltype(detail::dooly::make_policy_holder(
+			std::declval<Policies>()...));
+		using impl = detail::from_chars_unlimited_impl<Float>;
+		constexpr auto extended_digit_limit = impl::extended_digit_limit;
 
+		bool is_negative;
 		char const* ptr = begin;
 		assert(ptr != end);
 		if (*ptr == '-') {
 			is_negative = true;
 			++ptr;
-			++begin;
-			assert(ptr != end);
-		}
-		else if (*ptr == '+') {
-			is_negative = false;
-			++ptr;
-			++begin;
 			assert(ptr != end);
 		}
 		else {
 			is_negative = false;
-		}
-
-		// Scan significand digits.
-		bool first_nonzero_digit_found = false;
-		while (ptr != end) {
-			if (*ptr == '.') {
-				assert(decimal_dot_pos == end);
-				decimal_dot_pos = ptr;
-			}
-			else if (*ptr == 'e' || *ptr == 'E') {
-				significand_end_pos = ptr;
-				if (++ptr == end) {
-					break;
-				}
-				goto compute_exponent_label;
-			}
-			else {
-				assert(*ptr >= '0' && *ptr <= '9');
-				if (!first_nonzero_digit_found) {
-					if (*ptr != '0') {
-						first_nonzero_digit_found = true;
-					}
-					else {
-						++begin;
-					}
-				}
-			}
-			++ptr;
-		}
-		goto start_parsing_label;
-
-		// Compute exponent.
-	compute_exponent_label:
-		{
-			bool negative_exponent;
-			if (*ptr == '-') {
-				negative_exponent = true;
+			if (*ptr == '+') {
 				++ptr;
-			}
-			else if (*ptr == '+') {
-				negative_exponent = false;
-				++ptr;
-			}
-			else {
-				negative_exponent = false;
-			}
-			while (ptr != end) {
-				assert(*ptr >= '0' && *ptr <= '9');
-				// Assert that exponent never overflows.
-				assert(exponent + 1 <= std::numeric_limits<int>::max() / 10);
-				exponent *= 10;
-				exponent += (*ptr - '0');
-				++ptr;
-			}
-
-			if (negative_exponent) {
-				exponent = -exponent;
+				assert(ptr != end);
 			}
 		}
 
-	start_parsing_label:
-		constexpr auto digit_limit = 
-			to_binary_limited_precision_digit_limit<ieee754_traits<Float>::format>;
-
-		// Normalize
-		if (decimal_dot_pos != end) {
-			exponent += int((decimal_dot_pos - begin) - digit_limit);
-		}
-		else {
-			exponent += int((significand_end_pos - begin) - digit_limit);
-		}
-		if (begin >= decimal_dot_pos) {
-			++begin;
-		}
-
-		// Read initial segments.
-		ptr = begin;
-		using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
-		carrier_uint significand = 0;
-		if constexpr (ieee754_format_info<ieee754_traits<Float>::format>::format == ieee754_format::binary32)
+		// Skip leading zeros.
+		// The significand is significand * 10^exponent, up to the digits not read.
+		std::uint64_t significand = 0;
+		int exponent = 0;
+		bool decimal_dot_found = false;
+		detail::digit_group_reader<Format> integer_part_reader{ false };
+		detail::digit_group_reader<Format> fractional_part_reader{ true };
 		{
-			for (int i = 0; i < digit_limit; ++i) {
-				significand *= 10;
-
-				if (*ptr == '.') {
-					++ptr;
-				}
-				if (ptr != significand_end_pos) {
-					assert(*ptr >= '0' && *ptr <= '9');
-					significand += (*ptr - '0');
-					++ptr;
-				}
-			}
+			int zeros = 0;
+			ptr = integer_part_reader.skip_zeros(ptr, end, zeros);
 		}
-		else {
-			// Avoid 64-bit multiplications.
-			static_assert(digit_limit <= 18);
-
-			std::uint32_t significand32 = 0;
-			for (int i = 0; i < digit_limit - 9; ++i) {
-				significand32 *= 10;
-
-				if (*ptr == '.') {
-					++ptr;
-				}
-				if (ptr != significand_end_pos) {
-					assert(*ptr >= '0' && *ptr <= '9');
-					significand32 += (*ptr - '0');
-					++ptr;
-				}
-			}
-			significand = carrier_uint(10'0000'0000) * significand32;
-			significand32 = 0;
-			for (int i = 0; i < 9; ++i) {
-				significand32 *= 10;
-
-				if (*ptr == '.') {
-					++ptr;
-				}
-				if (ptr != significand_end_pos) {
-					assert(*ptr >= '0' && *ptr <= '9');
-					significand32 += (*ptr - '0');
-					++ptr;
-				}
-			}
-			significand += significand32;
-		}		
-
-		// Compute the initial guess.
-		auto f = to_binary_limited_precision(unsigned_decimal_fp<Float>{ significand, exponent });
-		if (is_negative) {
-			f.u |= ieee754_traits<Float>::negative_zero();
-		}
-
-		if (ptr == significand_end_pos) {
-			return f;
+		if (ptr != end && *ptr == Format::decimal_point) {
+			decimal_dot_found = true;
+			++ptr;
+			int zeros = 0;
+			ptr = fractional_part_reader.skip_zeros(ptr, end, zeros);
+			exponent -= zeros;
 		}
+		char const* const significand_begin_pos = ptr;
 
-		// Generate digits of the right boundary point of the search interval.
-		// For the case of round-to-nearest, it is the middle point between
-		// the current number and the next smallest number.
-		ryu_printf<Float> digit_gen{ f, std::bool_constant<true>{} };
-
-		// Compare g (significand) times 10^(k + n * eta) to s (the boundary point),
-		// where k is the decimal exponent, n is the segment index,
-		// and eta is the segment length.
-		// Let d be the number of digits of g, then:
-		//  - if k + n * eta + d - 1 >= eta, then g * 10^(k + n * eta) > s.
-		//  - if k + n * eta + d <= 0, then g * 10^(k + n * eta) < s.
-		//  - the above two conditions are not met if and only if
-		//    0 <= k + n * eta + d - 1 < eta.
-		auto initial_comparison_digits = exponent + digit_limit
-			+ digit_gen.current_segment_index() * ryu_printf<Float>::segment_size;
-
-		if (initial_comparison_digits <= 0) {
-			// Boundary point is strictly greater.
-			return f;
-		}
-		else if (initial_comparison_digits > ryu_printf<Float>::segment_size) {
-			// Boundary point is strictly smaller.
-			++f.u;
-			return f;
+		// Read the first significant digits.
+		int digits = 0;
+		if (decimal_dot_found) {
+			ptr = fractional_part_reader.accumulate(ptr, end, significand, digits,
+				extended_digit_limit);
+			exponent -= digits;
 		}
 		else {
-			static_assert(digit_limit >= ryu_printf<Float>::segment_size);
-
-			ptr = begin;
-			std::uint32_t significand32 = 0;
-			for (int i = 0; i < initial_comparison_digits; ++i) {
-				significand32 *= 10;
-
-				if (*ptr == '.') {
-					++ptr;
-				}
-				if (ptr != significand_end_pos) {
-					assert(*ptr >= '0' && *ptr <= '9');
-					significand32 += (*ptr - '0');
-					++ptr;
-				}
+			ptr = integer_part_reader.accumulate(ptr, end, significand, digits,
+				extended_digit_limit);
+			if (ptr != end && *ptr == Format::decimal_point) {
+				decimal_dot_found = true;
+				++ptr;
+				int fractional_digits = 0;
+				ptr = fractional_part_reader.accumulate(ptr, end, significand, fractional_digits,
+					extended_digit_limit - digits);
+				exponent -= fractional_digits;
+				digits += fractional_digits;
 			}
+		}
 
-			if (significand32 > digit_gen.current_segment()) {
-				// Boundary point is strictly smaller.
-				++f.u;
-				return f;
-			}
-			else if (significand32 < digit_gen.current_segment()) {
-				// Boundary point is strictly greater.
-				return f;
+		// Skip the remaining digits.
+		int skipped_digits = 0;
+		if (!decimal_dot_found) {
+			ptr = integer_part_reader.skip(ptr, end, skipped_digits);
+			exponent += skipped_digits;
+			if (ptr != end && *ptr == Format::decimal_point) {
+				decimal_dot_found = true;
+				++ptr;
 			}
 		}
+		if (decimal_dot_found) {
+			ptr = fractional_part_reader.skip(ptr, end, skipped_digits);
+			fractional_part_reader.finish();
+		}
+		integer_part_reader.finish();
+		bool const has_more_digits = skipped_digits != 0;
+		char const* const significand_end_pos = ptr;
+
+		// Read the exponent.
+		assert(Format::exponent == exponent_part::optional || ptr != end);
+		if (ptr != end) {
+			assert(*ptr == 'e' || *ptr == 'E');
+			++ptr;
 
-		while (ptr != significand_end_pos) {
-			digit_gen.compute_next_segment();
-
-			std::uint32_t significand32 = 0;
-			for (int i = 0; i < ryu_printf<Float>::segment_size; ++i) {
-				significand32 *= 10;
-
-				if (*ptr == '.') {
+			bool negative_exponent = false;
+			if (ptr != end) {
+				if (*ptr == '-') {
+					negative_exponent = true;
 					++ptr;
 				}
-				if (ptr != significand_end_pos) {
-					assert(*ptr >= '0' && *ptr <= '9');
-					significand32 += (*ptr - '0');
+				else if (*ptr == '+') {
 					++ptr;
 				}
 			}
 
-			if (significand32 > digit_gen.current_segment()) {
-				// Boundary point is strictly smaller.
-				++f.u;
-				return f;
-			}
-			else if (significand32 < digit_gen.current_segment()) {
-				// Boundary point is strictly bigger.
-				return f;
+			int exp = 0;
+			for (; ptr != end; ++ptr) {
+				assert(*ptr >= '0' && *ptr <= '9');
+				// Assert that exponent never overflows.
+				assert(exp + 1 <= std::numeric_limits<int>::max() / 10);
+				exp *= 10;
+				exp += (*ptr - '0');
 			}
+			exponent += negative_exponent ? -exp : exp;
 		}
 
-		if (digit_gen.has_further_nonzero_segments()) {
-			// Boundary point is strictly bigger.
-			return f;
-		}
-
-		// Tie!
-		if (f.u % 2 != 0) {
-			++f.u;
+		if constexpr (!policy_holder_t::sign_policy::return_has_sign) {
+			is_negative = false;
 		}
-
-		return f;
+		ieee754_bits<Float> sign_bits{ is_negative ?
+			ieee754_traits<Float>::negative_zero() : ieee754_traits<Float>::positive_zero() };
+
+		return detail::dooly::delegate<policy_holder_t>(sign_bits,
+			[&](auto interval_type_provider) {
+				using policy_impl = detail::from_chars_unlimited_impl<Float,
+					decltype(interval_type_provider), typename policy_holder_t::cache_policy>;
+
+				ieee754_bits<Float> result;
+				if (policy_impl::compute_fast(is_negative, significand, digits, exponent,
+					has_more_digits, result))
+				{
+					return result;
+				}
+				return policy_impl::compute_slow(is_negative, significand, digits, exponent,
+					significand_begin_pos, significand_end_pos);
+			});
 	}
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,454 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#ifndef JKJ_HEADER_FP_FROM_CHARS_COMMON
+#define JKJ_HEADER_FP_FROM_CHARS_COMMON
+
+#include "../detail/bits.h"
+#include "../detail/util.h"
+#include "../detail/macros.h"
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && defined(__AVX__))
+#define JKJ_FROM_CHARS_HAS_SSE41 1
+#include <immintrin.h>
+#else
+#define JKJ_FROM_CHARS_HAS_SSE41 0
+#endif
+
+#if defined(__AVX2__)
+#define JKJ_FROM_CHARS_HAS_AVX2 1
+#else
+#define JKJ_FROM_CHARS_HAS_AVX2 0
+#endif
+
+namespace jkj::fp {
+	// How group separators are treated by the from_chars family.
+	// ignore: separators may appear anywhere between digits.
+	// every_third_digit: separators must appear exactly at every third digit counted from
+	// the decimal point; as for other malformed inputs, this is only checked by assertions.
+	enum class digit_grouping { ignore, every_third_digit };
+
+	// Whether the exponent part (e.g., e+10) is optional or mandatory.
+	enum class exponent_part { optional, required };
+
+	// Compile-time description of the textual format accepted by the from_chars family.
+	// group_separator being '\0' means there is no group separator.
+	// For example, parse_format<',', '.'> reads 1.234,56, and parse_format<'.', '_'>
+	// reads 1_000_000.5.
+	template <char decimal_point_ = '.', char group_separator_ = '\0',
+		digit_grouping grouping_ = digit_grouping::ignore,
+		exponent_part exponent_ = exponent_part::optional>
+	struct parse_format {
+		static constexpr char decimal_point = decimal_point_;
+		static constexpr char group_separator = group_separator_;
+		static constexpr bool has_group_separator = group_separator_ != '\0';
+		static constexpr digit_grouping grouping = grouping_;
+		static constexpr exponent_part exponent = exponent_;
+
+		static_assert(decimal_point != group_separator);
+		static_assert((unsigned char)(decimal_point - '0') >= 10 &&
+			(unsigned char)(group_separator - '0') >= 10,
+			"digits cannot be used as a decimal point or a group separator");
+	};
+
+	using default_parse_format = parse_format<>;
+
+	namespace detail {
+		constexpr bool is_decimal_digit(char c) noexcept {
+			return (unsigned char)(c - '0') < 10;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////
+		// Utilities for parsing 8 digits at once inside a 64-bit integer.
+		////////////////////////////////////////////////////////////////////////////////////////
+
+		namespace swar {
+			constexpr std::uint64_t broadcast(unsigned char c) noexcept {
+				return std::uint64_t(0x0101'0101'0101'0101) * c;
+			}
+
+			// The first character goes to the lowest byte regardless of the endianness.
+			// Compilers translate this into a single load on little-endian machines.
+			inline std::uint64_t load_8_bytes(char const* ptr) noexcept {
+				unsigned char bytes[8];
+				std::memcpy(bytes, ptr, 8);
+				return std::uint64_t(bytes[0]) | (std::uint64_t(bytes[1]) << 8)
+					| (std::uint64_t(bytes[2]) << 16) | (std::uint64_t(bytes[3]) << 24)
+					| (std::uint64_t(bytes[4]) << 32) | (std::uint64_t(bytes[5]) << 40)
+					| (std::uint64_t(bytes[6]) << 48) | (std::uint64_t(bytes[7]) << 56);
+			}
+
+			// The MSB of each byte is set if the corresponding character is not a digit.
+			// Only the lowest set byte is guaranteed to be exact; carries from a non-digit
+			// byte may cause false positives in higher bytes, but we never look at them.
+			constexpr std::uint64_t non_digit_mask(std::uint64_t chunk) noexcept {
+				// Digits are mapped into [0,9], and everything else is mapped outside.
+				auto const x = chunk ^ broadcast('0');
+				return ((x + broadcast(0x80 - 10)) | x) & broadcast(0x80);
+			}
+
+			// Returns the number of leading digit characters, which is in [0,8].
+			inline int leading_digit_count(std::uint64_t chunk) noexcept {
+				auto const mask = non_digit_mask(chunk);
+				return mask == 0 ? 8 : (bits::countr_zero(mask) >> 3);
+			}
+
+			// Each byte of v should be already converted into a number in [0,9].
+			// The lowest byte is the most significant digit.
+			constexpr std::uint32_t parse_8_digits_unchecked(std::uint64_t v) noexcept {
+				constexpr auto mask = std::uint64_t(0x0000'00ff'0000'00ff);
+				constexpr auto mul1 = std::uint64_t(100) + (std::uint64_t(100'0000) << 32);
+				constexpr auto mul2 = std::uint64_t(1) + (std::uint64_t(1'0000) << 32);
+
+				// Each of bytes 0, 2, 4, 6 now holds a 2-digit number.
+				v = (v * 10) + (v >> 8);
+				return std::uint32_t((((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32);
+			}
+
+			// Precondition: all 8 characters are digits.
+			constexpr std::uint32_t parse_8_digits(std::uint64_t chunk) noexcept {
+				return parse_8_digits_unchecked(chunk - broadcast('0'));
+			}
+
+			// Parse the first n characters of chunk, which should be digits.
+			// Remaining characters can be anything.
+			inline std::uint32_t parse_leading_digits(std::uint64_t chunk, int n) noexcept {
+				assert(n > 0 && n <= 8);
+				// Borrows caused by non-digit bytes only propagate toward higher bytes,
+				// which are then shifted out. Vacated lower bytes act as leading zeros.
+				return parse_8_digits_unchecked((chunk - broadcast('0')) << ((8 - n) * 8));
+			}
+		}
+
+#if JKJ_FROM_CHARS_HAS_SSE41
+		////////////////////////////////////////////////////////////////////////////////////////
+		// Utilities for parsing 16 digits at once using SSE4.1.
+		////////////////////////////////////////////////////////////////////////////////////////
+
+		namespace simd {
+			inline __m128i load_16_bytes(char const* ptr) noexcept {
+				return _mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr));
+			}
+
+			// Bit i is set if the i-th character is not a digit.
+			inline std::uint32_t non_digit_mask(__m128i chunk) noexcept {
+				auto const t = _mm_sub_epi8(chunk, _mm_set1_epi8('0'));
+				auto const is_digit = _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(9)), t);
+				return ~std::uint32_t(_mm_movemask_epi8(is_digit)) & 0xffff;
+			}
+
+			// Precondition: all 16 characters are digits.
+			inline std::uint64_t parse_16_digits(__m128i chunk) noexcept {
+				auto const t = _mm_sub_epi8(chunk, _mm_set1_epi8('0'));
+				// 2-digit numbers in 16-bit lanes
+				auto const r2 = _mm_maddubs_epi16(t,
+					_mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+				// 4-digit numbers in 32-bit lanes
+				auto const r4 = _mm_madd_epi16(r2,
+					_mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+				// 8-digit numbers in 32-bit lanes
+				auto const r8 = _mm_madd_epi16(_mm_packus_epi32(r4, r4),
+					_mm_setr_epi16(1'0000, 1, 1'0000, 1, 1'0000, 1, 1'0000, 1));
+
+				return std::uint64_t(std::uint32_t(_mm_cvtsi128_si32(r8))) * 1'0000'0000
+					+ std::uint32_t(_mm_extract_epi32(r8, 1));
+			}
+		}
+#endif
+
+		// Returns the first position in [first, last) that is not a digit.
+		inline char const* skip_digits(char const* first, char const* last) noexcept {
+#if JKJ_FROM_CHARS_HAS_AVX2
+			while (last - first >= 32) {
+				auto const t = _mm256_sub_epi8(
+					_mm256_loadu_si256(reinterpret_cast<__m256i const*>(first)),
+					_mm256_set1_epi8('0'));
+				auto const is_digit = _mm256_cmpeq_epi8(
+					_mm256_min_epu8(t, _mm256_set1_epi8(9)), t);
+				auto const mask = ~std::uint32_t(_mm256_movemask_epi8(is_digit));
+				if (mask != 0) {
+					return first + bits::countr_zero(mask);
+				}
+				first += 32;
+			}
+#endif
+#if JKJ_FROM_CHARS_HAS_SSE41
+			while (last - first >= 16) {
+				auto const mask = simd::non_digit_mask(simd::load_16_bytes(first));
+				if (mask != 0) {
+					return first + bits::countr_zero(mask);
+				}
+				first += 16;
+			}
+#endif
+			while (last - first >= 8) {
+				auto const n = swar::leading_digit_count(swar::load_8_bytes(first));
+				first += n;
+				if (n != 8) {
+					return first;
+				}
+			}
+			while (first != last && is_decimal_digit(*first)) {
+				++first;
+			}
+			return first;
+		}
+
+		// Accumulates the run of digits starting at first into value, and
+		// returns the first position in [first, last) that is not a digit.
+		// Precondition: the resulting value does not overflow.
+		template <class UInt>
+		JKJ_FORCEINLINE char const* accumulate_digits(char const* first, char const* last,
+			UInt& value) noexcept
+		{
+			static_assert(std::is_unsigned_v<UInt>);
+			constexpr auto const& pow10 =
+				pow_table<UInt, 10, std::numeric_limits<UInt>::digits10 + 1>::table;
+
+#if JKJ_FROM_CHARS_HAS_SSE41
+			if constexpr (value_bits<UInt> >= 64) {
+				if (last - first >= 16) {
+					auto const chunk = simd::load_16_bytes(first);
+					if (simd::non_digit_mask(chunk) == 0) {
+						assert(value <= (std::numeric_limits<UInt>::max() - (pow10[16] - 1)) / pow10[16]);
+						value = value * pow10[16] + UInt(simd::parse_16_digits(chunk));
+						first += 16;
+					}
+				}
+			}
+#endif
+			while (last - first >= 8) {
+				auto const chunk = swar::load_8_bytes(first);
+				auto const n = swar::leading_digit_count(chunk);
+				if (n == 0) {
+					return first;
+				}
+				value = value * pow10[n] + UInt(swar::parse_leading_digits(chunk, n));
+				first += n;
+				if (n != 8) {
+					return first;
+				}
+			}
+			for (; first != last && is_decimal_digit(*first); ++first) {
+				value = value * 10 + UInt(*first - '0');
+			}
+			return first;
+		}
+
+		// Same as above, but reads at most max_count digits.
+		template <class UInt>
+		JKJ_FORCEINLINE char const* accumulate_digits(char const* first, char const* last,
+			UInt& value, int max_count) noexcept
+		{
+			static_assert(std::is_unsigned_v<UInt>);
+			constexpr auto const& pow10 =
+				pow_table<UInt, 10, std::numeric_limits<UInt>::digits10 + 1>::table;
+
+#if JKJ_FROM_CHARS_HAS_SSE41
+			if constexpr (value_bits<UInt> >= 64) {
+				if (max_count >= 16 && last - first >= 16) {
+					auto const chunk = simd::load_16_bytes(first);
+					if (simd::non_digit_mask(chunk) == 0) {
+						value = value * pow10[16] + UInt(simd::parse_16_digits(chunk));
+						first += 16;
+						max_count -= 16;
+					}
+				}
+			}
+#endif
+			while (max_count > 0 && last - first >= 8) {
+				auto const chunk = swar::load_8_bytes(first);
+				auto n = swar::leading_digit_count(chunk);
+				if (n > max_count) {
+					n = max_count;
+				}
+				if (n == 0) {
+					return first;
+				}
+				value = value * pow10[n] + UInt(swar::parse_leading_digits(chunk, n));
+				first += n;
+				max_count -= n;
+				if (n != 8) {
+					return first;
+				}
+			}
+			for (; max_count > 0 && first != last && is_decimal_digit(*first); ++first, --max_count) {
+				value = value * 10 + UInt(*first - '0');
+			}
+			return first;
+		}
+
+		// Reads count digits from [ptr, last) into a 32-bit integer and advances ptr.
+		// Non-digits inside [ptr, last), i.e., the decimal point and group separators,
+		// are skipped, and the digits are padded with trailing zeros when we reach last.
+		JKJ_FORCEINLINE std::uint32_t read_segment(char const*& ptr, char const* last,
+			int count) noexcept
+		{
+			constexpr auto const& pow10 = pow_table<std::uint32_t, 10, 10>::table;
+			assert(count >= 0 && count <= 9);
+
+			std::uint32_t value = 0;
+			while (count > 0) {
+				while (ptr != last && !is_decimal_digit(*ptr)) {
+					++ptr;
+				}
+				if (last - ptr >= 8) {
+					auto const chunk = swar::load_8_bytes(ptr);
+					auto n = swar::leading_digit_count(chunk);
+					assert(n != 0);
+					if (n > count) {
+						n = count;
+					}
+					value = value * pow10[n] + swar::parse_leading_digits(chunk, n);
+					ptr += n;
+					count -= n;
+				}
+				else if (ptr != last) {
+					assert(is_decimal_digit(*ptr));
+					value = value * 10 + std::uint32_t(*ptr - '0');
+					++ptr;
+					--count;
+				}
+				else {
+					value *= pow10[count];
+					break;
+				}
+			}
+			return value;
+		}
+
+		// Reads the digits of either the integer part or the fractional part, which may be
+		// interleaved with group separators. Runs of digits between separators are read by
+		// the routines above, so the default format compiles to plain digit loops.
+		// One reader should be used for all the digits of a part, so that
+		// group sizes are tracked across calls.
+		template <class Format>
+		class digit_group_reader {
+			static constexpr bool validates_grouping = Format::has_group_separator &&
+				Format::grouping == digit_grouping::every_third_digit;
+
+			[[maybe_unused]] bool is_fractional_;
+			[[maybe_unused]] int number_of_separators_ = 0;
+			[[maybe_unused]] int group_size_ = 0;
+
+			JKJ_FORCEINLINE void on_digits([[maybe_unused]] int count) noexcept {
+				if constexpr (validates_grouping) {
+					group_size_ += count;
+				}
+			}
+
+			// Returns true if ptr points to a separator, and moves past it.
+			JKJ_FORCEINLINE bool skip_separator(char const*& ptr, char const* last) noexcept {
+				if constexpr (Format::has_group_separator) {
+					if (ptr != last && *ptr == Format::group_separator) {
+						if constexpr (validates_grouping) {
+							// The first group of the integer part may be shorter.
+							assert(group_size_ == 3 || (!is_fractional_ &&
+								number_of_separators_ == 0 && group_size_ >= 1 && group_size_ < 3));
+							++number_of_separators_;
+							group_size_ = 0;
+						}
+						++ptr;
+						return true;
+					}
+				}
+				return false;
+			}
+
+		public:
+			explicit digit_group_reader(bool is_fractional) noexcept
+				: is_fractional_{ is_fractional } {}
+
+			// Skips zeros, and returns the number of zeros skipped.
+			JKJ_FORCEINLINE char const* skip_zeros(char const* first, char const* last,
+				int& count) noexcept
+			{
+				do {
+					auto const run_first = first;
+					while (first != last && *first == '0') {
+						++first;
+					}
+					count += int(first - run_first);
+					on_digits(int(first - run_first));
+				} while (skip_separator(first, last));
+				return first;
+			}
+
+			// Accumulates digits into value, and adds the number of digits to count.
+			template <class UInt>
+			JKJ_FORCEINLINE char const* accumulate(char const* first, char const* last,
+				UInt& value, int& count) noexcept
+			{
+				do {
+					auto const next = accumulate_digits(first, last, value);
+					count += int(next - first);
+					on_digits(int(next - first));
+					first = next;
+				} while (skip_separator(first, last));
+				return first;
+			}
+
+			// Same as above, but reads at most max_count digits.
+			template <class UInt>
+			JKJ_FORCEINLINE char const* accumulate(char const* first, char const* last,
+				UInt& value, int& count, int max_count) noexcept
+			{
+				do {
+					auto const next = accumulate_digits(first, last, value, max_count);
+					count += int(next - first);
+					max_count -= int(next - first);
+					on_digits(int(next - first));
+					first = next;
+				} while (max_count > 0 && skip_separator(first, last));
+				return first;
+			}
+
+			// Skips digits, and adds the number of digits skipped to count.
+			JKJ_FORCEINLINE char const* skip(char const* first, char const* last,
+				int& count) noexcept
+			{
+				do {
+					auto const next = skip_digits(first, last);
+					count += int(next - first);
+					on_digits(int(next - first));
+					first = next;
+				} while (skip_separator(first, last));
+				return first;
+			}
+
+			// Should be called after all the digits of the part are read.
+			void finish() const noexcept {
+				if constexpr (validates_grouping) {
+					if (number_of_separators_ != 0) {
+						assert(is_fractional_ ?
+							(group_size_ >= 1 && group_size_ <= 3) : group_size_ == 3);
+					}
+				}
+			}
+		};
+	}
+}
+
+#undef JKJ_FROM_CHARS_HAS_SSE41
+#undef JKJ_FROM_CHARS_HAS_AVX2
+#include "../detail/undef_macros.h"
+#endif
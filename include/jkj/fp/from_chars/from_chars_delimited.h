@@ -0,0 +1,480 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#ifndef JKJ_HEADER_FP_FROM_CHARS_FROM_CHARS_DELIMITED
+#define JKJ_HEADER_FP_FROM_CHARS_FROM_CHARS_DELIMITED
+
+#include "from_chars.h"
+#include "from_chars_common.h"
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace jkj::fp {
+	namespace detail {
+		inline unsigned int default_number_of_threads() noexcept {
+			auto const n = std::thread::hardware_concurrency();
+			return n == 0 ? 1 : n;
+		}
+	}
+
+	// Threads shared by the passes of from_chars_delimited; a caller parsing many buffers
+	// can keep one to avoid starting threads for each call.
+	// The calling thread takes part in the work, so a pool of n threads starts n - 1 threads
+	// (0 means the hardware concurrency). If some of them cannot be started, the pool works
+	// with the ones that could. A pool should not be used by several calls at the same time.
+	class from_chars_thread_pool {
+		std::vector<std::thread> threads_;
+		std::mutex mutex_;
+		std::condition_variable work_cv_;
+		std::condition_variable done_cv_;
+		bool stop_ = false;
+		std::size_t generation_ = 0;
+		std::size_t number_of_busy_workers_ = 0;
+
+		// The current job.
+		void (*invoke_)(void*, std::size_t) = nullptr;
+		void* func_ = nullptr;
+		std::size_t count_ = 0;
+		std::atomic<std::size_t> next_index_{ 0 };
+		std::exception_ptr exception_;
+
+		// Each thread picks up the next index when it is done with the previous one,
+		// so threads running into cheaper indices take over the remaining work.
+		void work() noexcept {
+			try {
+				for (auto i = next_index_.fetch_add(1, std::memory_order_relaxed); i < count_;
+					i = next_index_.fetch_add(1, std::memory_order_relaxed))
+				{
+					invoke_(func_, i);
+				}
+			}
+			catch (...) {
+				std::lock_guard<std::mutex> lock{ mutex_ };
+				if (!exception_) {
+					exception_ = std::current_exception();
+				}
+				// Let the other threads stop early.
+				next_index_.store(count_, std::memory_order_relaxed);
+			}
+		}
+
+		void worker_loop() noexcept {
+			std::size_t generation = 0;
+			while (true) {
+				{
+					std::unique_lock<std::mutex> lock{ mutex_ };
+					work_cv_.wait(lock, [&] { return stop_ || generation_ != generation; });
+					if (stop_) {
+						return;
+					}
+					generation = generation_;
+				}
+				work();
+				std::lock_guard<std::mutex> lock{ mutex_ };
+				if (--number_of_busy_workers_ == 0) {
+					done_cv_.notify_one();
+				}
+			}
+		}
+
+	public:
+		explicit from_chars_thread_pool(unsigned int number_of_threads = 0) {
+			if (number_of_threads == 0) {
+				number_of_threads = detail::default_number_of_threads();
+			}
+			threads_.reserve(number_of_threads - 1);
+			try {
+				for (unsigned int i = 1; i < number_of_threads; ++i) {
+					threads_.emplace_back([this] { worker_loop(); });
+				}
+			}
+			catch (std::system_error const&) {
+				// Work with the threads started so far.
+			}
+		}
+
+		from_chars_thread_pool(from_chars_thread_pool const&) = delete;
+		from_chars_thread_pool& operator=(from_chars_thread_pool const&) = delete;
+
+		~from_chars_thread_pool() {
+			{
+				std::lock_guard<std::mutex> lock{ mutex_ };
+				stop_ = true;
+			}
+			work_cv_.notify_all();
+			for (auto& t : threads_) {
+				t.join();
+			}
+		}
+
+		// Including the calling thread.
+		unsigned int number_of_threads() const noexcept {
+			return unsigned(threads_.size()) + 1;
+		}
+
+		// Calls f(i) for each i in [0, count), and returns when all calls are done.
+		// An exception thrown by any of the calls is rethrown.
+		template <class Func>
+		void parallel_for(std::size_t count, Func f) {
+			if (threads_.empty() || count <= 1) {
+				for (std::size_t i = 0; i < count; ++i) {
+					f(i);
+				}
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock{ mutex_ };
+				invoke_ = [](void* func, std::size_t i) { (*static_cast<Func*>(func))(i); };
+				func_ = &f;
+				count_ = count;
+				next_index_.store(0, std::memory_order_relaxed);
+				exception_ = nullptr;
+				number_of_busy_workers_ = threads_.size();
+				++generation_;
+			}
+			work_cv_.notify_all();
+			work();
+
+			std::unique_lock<std::mutex> lock{ mutex_ };
+			done_cv_.wait(lock, [&] { return number_of_busy_workers_ == 0; });
+			if (exception_) {
+				std::rethrow_exception(exception_);
+			}
+		}
+	};
+
+	namespace detail {
+		class delimiter_set {
+			bool table_[256] = {};
+			bool blank_table_[256] = {};
+
+		public:
+			explicit delimiter_set(std::string_view delimiters) noexcept {
+				for (auto c : delimiters) {
+					table_[(unsigned char)c] = true;
+				}
+				// Blanks around a field are ignored unless they are delimiters.
+				for (auto c : { ' ', '\t', '\r' }) {
+					blank_table_[(unsigned char)c] = !table_[(unsigned char)c];
+				}
+			}
+
+			bool contains(char c) const noexcept {
+				return table_[(unsigned char)c];
+			}
+
+			char const* find_delimiter(char const* ptr, char const* last) const noexcept {
+				while (true) {
+					// Numbers mostly consist of digits.
+					ptr = skip_digits(ptr, last);
+					if (ptr == last || contains(*ptr)) {
+						return ptr;
+					}
+					++ptr;
+				}
+			}
+
+			void trim(char const*& first, char const*& last) const noexcept {
+				while (first != last && blank_table_[(unsigned char)*first]) {
+					++first;
+				}
+				while (first != last && blank_table_[(unsigned char)last[-1]]) {
+					--last;
+				}
+			}
+
+			// Calls f(field_first, field_last) for each field in [first, last).
+			// Each delimiter ends exactly one field, so two consecutive delimiters enclose
+			// an empty field. The text after the last delimiter is a field unless it is blank.
+			template <class Func>
+			void for_each_field(char const* first, char const* last, Func&& f) const {
+				while (first != last) {
+					auto field_last = find_delimiter(first, last);
+					if (field_last == last) {
+						auto field_first = first;
+						trim(field_first, field_last);
+						if (field_first != field_last) {
+							f(first, last);
+						}
+						return;
+					}
+					f(first, field_last);
+					first = field_last + 1;
+				}
+			}
+		};
+
+		// Reads digits interleaved with group separators, and returns the number of digits,
+		// or -1 if a separator is not between two digits or violates Format::grouping.
+		template <class Format>
+		int scan_digit_groups(char const*& ptr, char const* last,
+			[[maybe_unused]] bool is_fractional) noexcept
+		{
+			int digits = 0;
+			[[maybe_unused]] int number_of_separators = 0;
+			[[maybe_unused]] int group_size = 0;
+			while (true) {
+				auto const next = skip_digits(ptr, last);
+				digits += int(next - ptr);
+				group_size += int(next - ptr);
+				ptr = next;
+				if constexpr (Format::has_group_separator) {
+					if (ptr != last && *ptr == Format::group_separator) {
+						if (group_size == 0 || ptr + 1 == last || !is_decimal_digit(ptr[1])) {
+							return -1;
+						}
+						if constexpr (Format::grouping == digit_grouping::every_third_digit) {
+							// The first group of the integer part may be shorter.
+							if (group_size != 3 && (is_fractional || number_of_separators != 0 ||
+								group_size > 3))
+							{
+								return -1;
+							}
+						}
+						++number_of_separators;
+						group_size = 0;
+						++ptr;
+						continue;
+					}
+				}
+				break;
+			}
+			if constexpr (Format::has_group_separator &&
+				Format::grouping == digit_grouping::every_third_digit)
+			{
+				if (number_of_separators != 0 && (is_fractional ? group_size > 3 : group_size != 3)) {
+					return -1;
+				}
+			}
+			return digits;
+		}
+
+		// Checks if [first, last) is entirely a number from_chars_unlimited<Float, Format> can
+		// read: an optional sign, digits with an optional decimal point, and the exponent part.
+		// Exponents of more than 8 significant digits are rejected, as from_chars_unlimited
+		// does not handle them.
+		template <class Format>
+		bool is_well_formed_number(char const* first, char const* last) noexcept {
+			if (first != last && (*first == '+' || *first == '-')) {
+				++first;
+			}
+			auto digits = scan_digit_groups<Format>(first, last, false);
+			if (digits < 0) {
+				return false;
+			}
+			if (first != last && *first == Format::decimal_point) {
+				++first;
+				auto const fractional_digits = scan_digit_groups<Format>(first, last, true);
+				if (fractional_digits < 0) {
+					return false;
+				}
+				digits += fractional_digits;
+			}
+			if (digits == 0) {
+				return false;
+			}
+
+			if (first == last) {
+				return Format::exponent == exponent_part::optional;
+			}
+			if (*first != 'e' && *first != 'E') {
+				return false;
+			}
+			++first;
+			if (first != last && (*first == '+' || *first == '-')) {
+				++first;
+			}
+			if (first == last) {
+				return false;
+			}
+			while (first != last && *first == '0') {
+				++first;
+			}
+			auto const exponent_last = skip_digits(first, last);
+			return exponent_last == last && last - first <= 8;
+		}
+
+		struct delimited_chunk {
+			char const* first;
+			char const* last;
+			std::size_t count;
+			std::size_t offset;
+			std::vector<std::size_t> invalid_fields;
+		};
+
+		// Splits [first, last) into chunks right after delimiters, so that
+		// every field belongs to exactly one chunk.
+		inline std::vector<delimited_chunk> split_into_chunks(char const* first, char const* last,
+			delimiter_set const& delimiters, std::size_t number_of_chunks)
+		{
+			std::vector<delimited_chunk> chunks;
+			chunks.reserve(number_of_chunks);
+
+			auto const chunk_size = std::size_t(last - first) / number_of_chunks + 1;
+			while (first != last) {
+				auto chunk_last = std::size_t(last - first) <= chunk_size ? last : first + chunk_size;
+				chunk_last = delimiters.find_delimiter(chunk_last, last);
+				if (chunk_last != last) {
+					++chunk_last;
+				}
+				chunks.push_back({ first, chunk_last, 0, 0, {} });
+				first = chunk_last;
+			}
+			return chunks;
+		}
+
+		// Granularity of the parallel work; each thread gets several chunks to balance the load.
+		static constexpr std::size_t min_delimited_chunk_size = 1 << 16;
+		static constexpr unsigned int delimited_chunks_per_thread = 8;
+
+		inline std::vector<delimited_chunk> count_delimited_fields(char const* first,
+			char const* last, delimiter_set const& delimiters, from_chars_thread_pool& pool)
+		{
+			auto const max_number_of_chunks =
+				std::size_t(pool.number_of_threads()) * delimited_chunks_per_thread;
+			auto number_of_chunks = std::size_t(last - first) / min_delimited_chunk_size + 1;
+			if (number_of_chunks > max_number_of_chunks) {
+				number_of_chunks = max_number_of_chunks;
+			}
+			auto chunks = split_into_chunks(first, last, delimiters, number_of_chunks);
+
+			pool.parallel_for(chunks.size(), [&](std::size_t i) {
+				auto& chunk = chunks[i];
+				std::size_t count = 0;
+				delimiters.for_each_field(chunk.first, chunk.last,
+					[&](char const*, char const*) { ++count; });
+				chunk.count = count;
+			});
+
+			std::size_t offset = 0;
+			for (auto& chunk : chunks) {
+				chunk.offset = offset;
+				offset += chunk.count;
+			}
+			return chunks;
+		}
+
+		// Fields that are empty or malformed are written as a quiet NaN, and their indices
+		// are collected if invalid_fields is not null.
+		template <class Float, class Format>
+		void parse_delimited_chunks(std::vector<delimited_chunk>& chunks,
+			delimiter_set const& delimiters, Float* out, std::size_t capacity,
+			from_chars_thread_pool& pool, std::vector<std::size_t>* invalid_fields)
+		{
+			pool.parallel_for(chunks.size(), [&](std::size_t i) {
+				auto& chunk = chunks[i];
+				if (chunk.offset >= capacity && invalid_fields == nullptr) {
+					return;
+				}
+
+				auto index = chunk.offset;
+				delimiters.for_each_field(chunk.first, chunk.last,
+					[&](char const* field_first, char const* field_last) {
+						delimiters.trim(field_first, field_last);
+						bool const is_valid = is_well_formed_number<Format>(field_first, field_last);
+						if (index < capacity) {
+							out[index] = is_valid ?
+								from_chars_unlimited<Float, Format>(field_first, field_last).to_float() :
+								std::numeric_limits<Float>::quiet_NaN();
+						}
+						if (!is_valid && invalid_fields != nullptr) {
+							chunk.invalid_fields.push_back(index);
+						}
+						++index;
+					});
+			});
+
+			if (invalid_fields != nullptr) {
+				invalid_fields->clear();
+				for (auto const& chunk : chunks) {
+					invalid_fields->insert(invalid_fields->end(),
+						chunk.invalid_fields.begin(), chunk.invalid_fields.end());
+				}
+			}
+		}
+	}
+
+	// Parses the fields of [first, last) separated by any of the given delimiters, in parallel.
+	// Each delimiter ends exactly one field; blanks (spaces, tabs and carriage returns that are
+	// not delimiters) around a field are ignored, so lines may end with \r\n. The text after the
+	// last delimiter is a field unless it is blank.
+	// Writes at most capacity numbers into out in order, and returns the total number of
+	// fields in the input. Each number is parsed as from_chars_unlimited<Float, Format> does,
+	// which falls back to the limited-precision conversion whenever possible.
+	// A field that is empty or is not a number in Format, such as a header, is written as a
+	// quiet NaN. If invalid_fields is not null, it is filled with the indices of such fields
+	// in increasing order, including the ones past capacity.
+	template <class Float, class Format = default_parse_format>
+	std::size_t from_chars_delimited(char const* first, char const* last,
+		std::string_view delimiters, Float* out, std::size_t capacity,
+		from_chars_thread_pool& pool, std::vector<std::size_t>* invalid_fields = nullptr)
+	{
+		detail::delimiter_set const delimiter_set{ delimiters };
+
+		auto chunks = detail::count_delimited_fields(first, last, delimiter_set, pool);
+		detail::parse_delimited_chunks<Float, Format>(chunks, delimiter_set, out, capacity,
+			pool, invalid_fields);
+		return chunks.empty() ? 0 : chunks.back().offset + chunks.back().count;
+	}
+
+	// Same as above, using number_of_threads threads (0 means the hardware concurrency)
+	// started for this call.
+	template <class Float, class Format = default_parse_format>
+	std::size_t from_chars_delimited(char const* first, char const* last,
+		std::string_view delimiters, Float* out, std::size_t capacity,
+		unsigned int number_of_threads = 0, std::vector<std::size_t>* invalid_fields = nullptr)
+	{
+		from_chars_thread_pool pool{ number_of_threads };
+		return from_chars_delimited<Float, Format>(first, last, delimiters, out, capacity,
+			pool, invalid_fields);
+	}
+
+	template <class Float, class Format = default_parse_format>
+	std::vector<Float> from_chars_delimited(char const* first, char const* last,
+		std::string_view delimiters, from_chars_thread_pool& pool,
+		std::vector<std::size_t>* invalid_fields = nullptr)
+	{
+		detail::delimiter_set const delimiter_set{ delimiters };
+
+		auto chunks = detail::count_delimited_fields(first, last, delimiter_set, pool);
+		std::vector<Float> result(chunks.empty() ? 0 : chunks.back().offset + chunks.back().count);
+		detail::parse_delimited_chunks<Float, Format>(chunks, delimiter_set, result.data(),
+			result.size(), pool, invalid_fields);
+		return result;
+	}
+
+	template <class Float, class Format = default_parse_format>
+	std::vector<Float> from_chars_delimited(char const* first, char const* last,
+		std::string_view delimiters, unsigned int number_of_threads = 0,
+		std::vector<std::size_t>* invalid_fields = nullptr)
+	{
+		from_chars_thread_pool pool{ number_of_threads };
+		return from_chars_delimited<Float, Format>(first, last, delimiters, pool, invalid_fields);
+	}
+}
+
+#endif
@@ -0,0 +1,221 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#ifndef JKJ_HEADER_FP_FROM_CHARS_FROM_CHARS_HEX
+#define JKJ_HEADER_FP_FROM_CHARS_FROM_CHARS_HEX
+
+#include "../ieee754_format.h"
+#include "../detail/bits.h"
+#include "from_chars_common.h"
+#include <cassert>
+#include <cstdint>
+
+namespace jkj::fp {
+	namespace detail {
+		namespace hex {
+			// Returns a value larger than 15 if c is not a hexadecimal digit.
+			constexpr unsigned int digit_value(char c) noexcept {
+				auto const digit = (unsigned char)(c - '0');
+				auto const letter = (unsigned char)((c | 0x20) - 'a');
+				return digit < 10 ? digit : letter < 6 ? letter + 10u : 16u;
+			}
+
+			// Rounds (significand + sticky) * 2^exponent to the nearest, ties to even,
+			// where sticky is a positive number less than 1 if has_nonzero_tail is true.
+			template <class Float>
+			ieee754_bits<Float> round_to_float(bool is_negative, std::uint64_t significand,
+				int exponent, bool has_nonzero_tail) noexcept
+			{
+				using format_info = ieee754_format_info<ieee754_traits<Float>::format>;
+				using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
+				constexpr int significand_bits = format_info::significand_bits;
+
+				ieee754_bits<Float> result{ is_negative ?
+					ieee754_bits<Float>::negative_zero() : ieee754_bits<Float>::positive_zero() };
+				if (significand == 0) {
+					return result;
+				}
+
+				// Exponent of the most significant bit.
+				auto const msb = 63 - bits::countl_zero(significand);
+				if (exponent > format_info::max_exponent - msb) {
+					result.u |= ieee754_bits<Float>::positive_infinity();
+					return result;
+				}
+
+				// Number of bits to remove; subnormal numbers keep fewer bits.
+				auto shift = msb - significand_bits;
+				if (exponent + msb < format_info::min_exponent) {
+					shift = format_info::min_exponent - significand_bits - exponent;
+				}
+
+				std::uint64_t rounded;
+				if (shift <= 0) {
+					// Sticky digits are only possible when significand has 64 bits.
+					assert(!has_nonzero_tail);
+					rounded = significand << -shift;
+				}
+				else if (shift <= 64) {
+					auto const half = std::uint64_t(1) << (shift - 1);
+					auto const remainder = significand & (half + (half - 1));
+					rounded = shift == 64 ? 0 : (significand >> shift);
+					if (remainder > half ||
+						(remainder == half && (has_nonzero_tail || rounded % 2 != 0)))
+					{
+						++rounded;
+					}
+				}
+				else {
+					return result;
+				}
+
+				// The implicit bit of a normal number, and a carry from the rounding,
+				// both go into the exponent field.
+				auto const exponent_field = exponent + shift + significand_bits
+					- format_info::exponent_bias - 1;
+				assert(exponent_field >= 0);
+				result.u |= carrier_uint((carrier_uint(exponent_field) << significand_bits)
+					+ carrier_uint(rounded));
+				return result;
+			}
+		}
+	}
+
+	// Parses a hexadecimal floating-point number, such as -0x1.8p+3, with correct rounding.
+	// The 0x prefix and the binary exponent are optional, and inf and nan are recognized
+	// so that the output of to_chars_hex can be parsed back.
+	// As from_chars_limited, this function does not offer any proper parse error checking.
+	template <class Float>
+	ieee754_bits<Float> from_chars_hex(char const* begin, char const* end)
+	{
+		using format_info = ieee754_format_info<ieee754_traits<Float>::format>;
+		using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
+		constexpr int max_significant_digits = 16;
+		constexpr int max_exponent_magnitude = 1 << 20;
+
+		assert(begin != end);
+
+		bool is_negative = false;
+		if (*begin == '-') {
+			is_negative = true;
+			++begin;
+			assert(begin != end);
+		}
+		else if (*begin == '+') {
+			++begin;
+			assert(begin != end);
+		}
+
+		// inf and nan
+		if ((*begin | 0x20) == 'i') {
+			return ieee754_bits<Float>{ is_negative ?
+				ieee754_bits<Float>::negative_infinity() : ieee754_bits<Float>::positive_infinity() };
+		}
+		if ((*begin | 0x20) == 'n') {
+			auto const bits = carrier_uint(ieee754_bits<Float>::positive_infinity()
+				| (carrier_uint(1) << (format_info::significand_bits - 1)));
+			return ieee754_bits<Float>{ is_negative ?
+				carrier_uint(bits | ieee754_bits<Float>::negative_zero()) : bits };
+		}
+
+		if (end - begin >= 2 && begin[0] == '0' && (begin[1] | 0x20) == 'x') {
+			begin += 2;
+		}
+
+		std::uint64_t significand = 0;
+		int exponent = 0;
+		int digits = 0;
+		bool has_nonzero_tail = false;
+
+		// Skip leading zeros.
+		while (begin != end && *begin == '0') {
+			++begin;
+		}
+		if (begin != end && *begin == '.') {
+			++begin;
+			while (begin != end && *begin == '0') {
+				exponent -= 4;
+				++begin;
+			}
+			goto fractional_part_label;
+		}
+
+		// Integer part.
+		for (; begin != end; ++begin) {
+			auto const value = detail::hex::digit_value(*begin);
+			if (value > 15) {
+				break;
+			}
+			if (digits < max_significant_digits) {
+				significand = significand * 16 + value;
+				++digits;
+			}
+			else {
+				has_nonzero_tail |= (value != 0);
+				exponent += 4;
+			}
+		}
+		if (begin == end || *begin != '.') {
+			goto exponent_part_label;
+		}
+		++begin;
+
+	fractional_part_label:
+		for (; begin != end; ++begin) {
+			auto const value = detail::hex::digit_value(*begin);
+			if (value > 15) {
+				break;
+			}
+			if (digits < max_significant_digits) {
+				significand = significand * 16 + value;
+				++digits;
+				exponent -= 4;
+			}
+			else {
+				has_nonzero_tail |= (value != 0);
+			}
+		}
+
+	exponent_part_label:
+		if (begin != end && (*begin | 0x20) == 'p') {
+			++begin;
+			assert(begin != end);
+			bool is_negative_exponent = false;
+			if (*begin == '-') {
+				is_negative_exponent = true;
+				++begin;
+			}
+			else if (*begin == '+') {
+				++begin;
+			}
+
+			// Exponents too large in magnitude are saturated; they overflow or underflow anyway.
+			int exp = 0;
+			for (; begin != end && detail::is_decimal_digit(*begin); ++begin) {
+				if (exp < max_exponent_magnitude) {
+					exp = exp * 10 + (*begin - '0');
+				}
+			}
+			exponent += is_negative_exponent ? -exp : exp;
+		}
+
+		return detail::hex::round_to_float<Float>(is_negative, significand, exponent,
+			has_nonzero_tail);
+	}
+}
+
+#endif
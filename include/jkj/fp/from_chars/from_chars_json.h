@@ -0,0 +1,171 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#ifndef JKJ_HEADER_FP_FROM_CHARS_FROM_CHARS_JSON
+#define JKJ_HEADER_FP_FROM_CHARS_FROM_CHARS_JSON
+
+#include "from_chars.h"
+#include <cassert>
+#include <cstdint>
+
+namespace jkj::fp {
+	// Violations of the number grammar of RFC 8259:
+	//   number = [ "-" ] int [ frac ] [ exp ]
+	//   int    = "0" / ( digit1-9 *DIGIT )
+	//   frac   = "." 1*DIGIT
+	//   exp    = ( "e" / "E" ) [ "-" / "+" ] 1*DIGIT
+	enum class json_number_errc {
+		none,
+		// No digit at the beginning or after the minus sign; this includes a leading '+'.
+		missing_integer_part,
+		// A digit right after a leading zero, as in 01.
+		leading_zero,
+		// No digit after the decimal point.
+		missing_fractional_part,
+		// No digit after e, E, or the sign of the exponent.
+		missing_exponent_part
+	};
+
+	template <class Float>
+	struct from_chars_json_result {
+		ieee754_bits<Float> value;
+		// On success, one past the last character of the number.
+		// On failure, the position where the grammar is violated; value is then unspecified.
+		char const* ptr;
+		json_number_errc ec;
+	};
+
+	// Parses a number in the strict JSON grammar, validating and converting in one pass.
+	// Parsing stops at the first character that cannot continue the number, which is
+	// not checked; the caller's tokenizer decides whether it is a valid delimiter.
+	// Exponents larger than 2^26 in magnitude are saturated.
+	template <class Float>
+	from_chars_json_result<Float> from_chars_json(char const* begin, char const* end) noexcept
+	{
+		using impl = detail::from_chars_unlimited_impl<Float>;
+		constexpr auto extended_digit_limit = impl::extended_digit_limit;
+		constexpr int max_exponent_magnitude = 1 << 26;
+
+		from_chars_json_result<Float> result{ {}, begin, json_number_errc::none };
+		char const* ptr = begin;
+
+		bool is_negative = false;
+		if (ptr != end && *ptr == '-') {
+			is_negative = true;
+			++ptr;
+		}
+
+		// The significand is significand * 10^exponent, up to the digits not read.
+		std::uint64_t significand = 0;
+		int exponent = 0;
+		int digits = 0;
+		int skipped_digits = 0;
+		char const* significand_begin_pos;
+		char const* significand_end_pos;
+
+		// Integer part.
+		if (ptr == end || !detail::is_decimal_digit(*ptr)) {
+			result.ec = json_number_errc::missing_integer_part;
+			goto error_label;
+		}
+		if (*ptr == '0') {
+			++ptr;
+			if (ptr != end && detail::is_decimal_digit(*ptr)) {
+				result.ec = json_number_errc::leading_zero;
+				goto error_label;
+			}
+			significand_begin_pos = ptr;
+		}
+		else {
+			significand_begin_pos = ptr;
+			ptr = detail::accumulate_digits(ptr, end, significand, extended_digit_limit);
+			digits = int(ptr - significand_begin_pos);
+
+			auto const next = detail::skip_digits(ptr, end);
+			skipped_digits = int(next - ptr);
+			exponent += skipped_digits;
+			ptr = next;
+		}
+
+		// Fractional part.
+		if (ptr != end && *ptr == '.') {
+			++ptr;
+			if (ptr == end || !detail::is_decimal_digit(*ptr)) {
+				result.ec = json_number_errc::missing_fractional_part;
+				goto error_label;
+			}
+
+			if (digits == 0) {
+				// Leading zeros are not significant.
+				auto const first = ptr;
+				while (ptr != end && *ptr == '0') {
+					++ptr;
+				}
+				exponent -= int(ptr - first);
+				significand_begin_pos = ptr;
+			}
+
+			auto const first = ptr;
+			ptr = detail::accumulate_digits(ptr, end, significand, extended_digit_limit - digits);
+			digits += int(ptr - first);
+			exponent -= int(ptr - first);
+
+			auto const next = detail::skip_digits(ptr, end);
+			skipped_digits += int(next - ptr);
+			ptr = next;
+		}
+		significand_end_pos = ptr;
+
+		// Exponent part.
+		if (ptr != end && (*ptr == 'e' || *ptr == 'E')) {
+			++ptr;
+			bool negative_exponent = false;
+			if (ptr != end && (*ptr == '-' || *ptr == '+')) {
+				negative_exponent = (*ptr == '-');
+				++ptr;
+			}
+			if (ptr == end || !detail::is_decimal_digit(*ptr)) {
+				result.ec = json_number_errc::missing_exponent_part;
+				goto error_label;
+			}
+
+			int exp = 0;
+			for (; ptr != end && detail::is_decimal_digit(*ptr); ++ptr) {
+				if (exp < max_exponent_magnitude) {
+					exp = exp * 10 + (*ptr - '0');
+				}
+			}
+			exponent += negative_exponent ? -exp : exp;
+		}
+		result.ptr = ptr;
+
+		// Numbers whose digits fit in the carrier type go to the limited-precision conversion.
+		if (!impl::compute_fast(is_negative, significand, digits, exponent,
+			skipped_digits != 0, result.value))
+		{
+			result.value = impl::compute_slow(is_negative, significand, digits, exponent,
+				significand_begin_pos, significand_end_pos);
+		}
+		return result;
+
+	error_label:
+		result.ptr = ptr;
+		return result;
+	}
+}
+
+#endif
@@ -0,0 +1,325 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#ifndef JKJ_HEADER_FP_FROM_CHARS_FROM_CHARS_STREAM
+#define JKJ_HEADER_FP_FROM_CHARS_FROM_CHARS_STREAM
+
+#include "from_chars.h"
+#include "from_chars_common.h"
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace jkj::fp {
+	// Resumable parser for a sequence of numbers delivered in chunks.
+	// Tokens are maximal runs of digits, signs, decimal dots and exponent markers, and a token
+	// may straddle several chunks. Each token yields the number at its beginning, and the rest
+	// of the token, as in the -01-05 of 2024-01-05, is ignored. For a token that is a number,
+	// the result is identical to that of from_chars_unlimited.
+	// Every token goes through the same state machine, and only the state needed to finish it
+	// is kept between chunks, so the results never depend on the chunking.
+	// As for from_chars_unlimited, this class does not offer any proper parse error checking.
+	template <class Float>
+	class from_chars_stream {
+		using impl = detail::from_chars_unlimited_impl<Float>;
+		using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
+		static constexpr int extended_digit_limit = impl::extended_digit_limit;
+
+		// Digits after this many significant digits can only affect the result
+		// through whether or not they are all zero.
+		static constexpr int max_significant_digits =
+			ryu_printf<Float>::max_nonzero_decimal_digits + 2;
+
+		enum class state_t : unsigned char {
+			idle,
+			sign,
+			leading_zeros,
+			leading_zeros_after_dot,
+			integer_digits,
+			fractional_digits,
+			exponent_marker,
+			exponent_sign,
+			exponent_digits,
+			// The number is complete, and the rest of its token is being skipped.
+			trailing
+		};
+
+		state_t state_ = state_t::idle;
+		bool is_negative_;
+		bool has_more_digits_;
+		bool has_nonzero_dropped_digits_;
+		bool is_negative_exponent_;
+		int digits_;
+		int exponent_;
+		int exp_;
+		int retained_digits_;
+		std::uint64_t significand_;
+
+		// The first extended_digit_limit digits are held in significand_ and are
+		// printed here only when needed; digits after them are retained as they are read.
+		char digit_buffer_[max_significant_digits + 1];
+
+		static constexpr bool is_token_char(char c) noexcept {
+			return detail::is_decimal_digit(c) || c == '.' || c == 'e' || c == 'E' ||
+				c == '+' || c == '-';
+		}
+
+		static char const* find_token_end(char const* ptr, char const* last) noexcept {
+			while (true) {
+				ptr = detail::skip_digits(ptr, last);
+				if (ptr == last || !is_token_char(*ptr)) {
+					return ptr;
+				}
+				++ptr;
+			}
+		}
+
+		void start_token() noexcept {
+			state_ = state_t::sign;
+			is_negative_ = false;
+			has_more_digits_ = false;
+			has_nonzero_dropped_digits_ = false;
+			is_negative_exponent_ = false;
+			digits_ = 0;
+			exponent_ = 0;
+			exp_ = 0;
+			retained_digits_ = 0;
+			significand_ = 0;
+		}
+
+		char const* read_digits(char const* ptr, char const* last, bool is_fractional) noexcept {
+			// Accumulate the first digits into the significand.
+			if (digits_ < extended_digit_limit) {
+				auto const next = detail::accumulate_digits(ptr, last, significand_,
+					extended_digit_limit - digits_);
+				digits_ += int(next - ptr);
+				if (is_fractional) {
+					exponent_ -= int(next - ptr);
+				}
+				ptr = next;
+			}
+
+			// Retain the remaining digits for the comparison with the boundary.
+			auto const next = detail::skip_digits(ptr, last);
+			if (next != ptr) {
+				has_more_digits_ = true;
+				if (!is_fractional) {
+					exponent_ += int(next - ptr);
+				}
+
+				constexpr int retained_digits_limit = max_significant_digits - extended_digit_limit;
+				auto count = int(next - ptr);
+				if (count > retained_digits_limit - retained_digits_) {
+					count = retained_digits_limit - retained_digits_;
+				}
+				std::memcpy(digit_buffer_ + extended_digit_limit + retained_digits_, ptr,
+					std::size_t(count));
+				retained_digits_ += count;
+
+				for (ptr += count; ptr != next; ++ptr) {
+					if (*ptr != '0') {
+						has_nonzero_dropped_digits_ = true;
+						return detail::skip_digits(ptr, last);
+					}
+				}
+			}
+			return next;
+		}
+
+		// Returns the position where the current token ends, or last if the token continues.
+		char const* resume(char const* ptr, char const* last) noexcept {
+			while (ptr != last) {
+				switch (state_) {
+				case state_t::sign:
+					if (*ptr == '-') {
+						is_negative_ = true;
+						++ptr;
+					}
+					else if (*ptr == '+') {
+						++ptr;
+					}
+					state_ = state_t::leading_zeros;
+					break;
+
+				case state_t::leading_zeros:
+					while (ptr != last && *ptr == '0') {
+						++ptr;
+					}
+					if (ptr != last) {
+						if (*ptr == '.') {
+							++ptr;
+							state_ = state_t::leading_zeros_after_dot;
+						}
+						else {
+							state_ = state_t::integer_digits;
+						}
+					}
+					break;
+
+				case state_t::leading_zeros_after_dot:
+				{
+					auto const zeros_begin = ptr;
+					while (ptr != last && *ptr == '0') {
+						++ptr;
+					}
+					exponent_ -= int(ptr - zeros_begin);
+					if (ptr != last) {
+						state_ = state_t::fractional_digits;
+					}
+				}
+				break;
+
+				case state_t::integer_digits:
+					ptr = read_digits(ptr, last, false);
+					if (ptr != last) {
+						if (*ptr == '.') {
+							++ptr;
+							state_ = state_t::fractional_digits;
+						}
+						else {
+							state_ = state_t::exponent_marker;
+						}
+					}
+					break;
+
+				case state_t::fractional_digits:
+					ptr = read_digits(ptr, last, true);
+					if (ptr != last) {
+						state_ = state_t::exponent_marker;
+					}
+					break;
+
+				case state_t::exponent_marker:
+					if (*ptr != 'e' && *ptr != 'E') {
+						return ptr;
+					}
+					++ptr;
+					state_ = state_t::exponent_sign;
+					break;
+
+				case state_t::exponent_sign:
+					if (*ptr == '-') {
+						is_negative_exponent_ = true;
+						++ptr;
+					}
+					else if (*ptr == '+') {
+						++ptr;
+					}
+					state_ = state_t::exponent_digits;
+					break;
+
+				case state_t::exponent_digits:
+					for (; ptr != last && detail::is_decimal_digit(*ptr); ++ptr) {
+						// Assert that exponent never overflows.
+						assert(exp_ + 1 <= std::numeric_limits<int>::max() / 10);
+						exp_ *= 10;
+						exp_ += (*ptr - '0');
+					}
+					return ptr;
+
+				default:
+					assert(false);
+					return ptr;
+				}
+			}
+			return ptr;
+		}
+
+		ieee754_bits<Float> complete_token() noexcept {
+			assert(state_ != state_t::idle && state_ != state_t::trailing);
+			state_ = state_t::idle;
+
+			auto const exponent = exponent_ + (is_negative_exponent_ ? -exp_ : exp_);
+			ieee754_bits<Float> result;
+			if (impl::compute_fast(is_negative_, significand_, digits_, exponent,
+				has_more_digits_, result))
+			{
+				return result;
+			}
+
+			// Print the first digits right before the retained digits.
+			auto const first = digit_buffer_ + (extended_digit_limit - digits_);
+			auto last = digit_buffer_ + (extended_digit_limit + retained_digits_);
+			auto significand = significand_;
+			for (auto ptr = digit_buffer_ + extended_digit_limit; ptr != first;) {
+				*--ptr = char('0' + significand % 10);
+				significand /= 10;
+			}
+			if (has_nonzero_dropped_digits_) {
+				*last++ = '1';
+			}
+
+			return impl::compute_slow(is_negative_, significand_, digits_, exponent, first, last);
+		}
+
+	public:
+		// Parses numbers in [first, last), and writes completed results into out.
+		// A number ending at last is kept pending, as it may continue in the next chunk.
+		template <class OutputIterator>
+		OutputIterator feed(char const* first, char const* last, OutputIterator out)
+		{
+			while (true) {
+				if (state_ == state_t::trailing) {
+					first = find_token_end(first, last);
+					if (first == last) {
+						return out;
+					}
+					state_ = state_t::idle;
+				}
+				else if (state_ != state_t::idle) {
+					first = resume(first, last);
+					if (first == last) {
+						return out;
+					}
+					*out = complete_token();
+					++out;
+					state_ = state_t::trailing;
+					continue;
+				}
+
+				while (first != last && !is_token_char(*first)) {
+					++first;
+				}
+				if (first == last) {
+					return out;
+				}
+				start_token();
+			}
+		}
+
+		// Completes the pending number, if any, at the end of the stream.
+		template <class OutputIterator>
+		OutputIterator finish(OutputIterator out)
+		{
+			if (state_ == state_t::trailing) {
+				state_ = state_t::idle;
+			}
+			else if (state_ != state_t::idle) {
+				*out = complete_token();
+				++out;
+			}
+			return out;
+		}
+
+		bool has_pending_token() const noexcept {
+			return state_ != state_t::idle && state_ != state_t::trailing;
+		}
+	};
+}
+
+#endif
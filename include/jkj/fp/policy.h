@@ -22,6 +22,7 @@
 #include "ieee754_format.h"
 #include "detail/log.h"
 #include "detail/dragonbox_cache.h"
+#include "detail/dragonbox_shorter_interval_table.h"
 #include "detail/util.h"
 #include "detail/macros.h"
 
@@ -360,6 +361,12 @@ namespace jkj::fp {
 
 		// Determines what to do with invalid inputs.
 		struct input_validation {};
+
+		// Determines whether to detect inputs that are integers.
+		struct integer_check {};
+
+		// Determines whether to evaluate unpredictable conditions with branches.
+		struct branch_strategy {};
 	}
 
 	namespace detail {
@@ -882,6 +889,7 @@ namespace jkj::fp {
 				struct fast {
 					using policy_kind = policy_kind::cache;
 					using cache_policy = fast;
+					static constexpr bool has_shorter_interval_table = false;
 					template <ieee754_format format>
 					static constexpr typename dragonbox::cache_holder<format>::cache_entry_type
 						get_cache(int k) noexcept
@@ -896,6 +904,7 @@ namespace jkj::fp {
 				struct compact {
 					using policy_kind = policy_kind::cache;
 					using cache_policy = compact;
+					static constexpr bool has_shorter_interval_table = false;
 					template <ieee754_format format>
 					static constexpr typename dragonbox::cache_holder<format>::cache_entry_type
 						get_cache(int k) noexcept
@@ -965,12 +974,62 @@ namespace jkj::fp {
 						}
 					}
 				};
+
+				// Looks up the entries for the numbers with decimal exponents in
+				// [min_decimal_exponent, max_decimal_exponent] from a dense table,
+				// and falls back to compact for the others.
+				template <int min_decimal_exponent, int max_decimal_exponent>
+				struct hot_range {
+					using policy_kind = policy_kind::cache;
+					using cache_policy = hot_range;
+					static constexpr bool has_shorter_interval_table = false;
+
+					template <ieee754_format format>
+					static constexpr typename dragonbox::cache_holder<format>::cache_entry_type
+						get_cache(int k) noexcept
+					{
+						using hot_range_cache = dragonbox::hot_range_cache_detail<format,
+							dragonbox::impl_base<format>::kappa,
+							min_decimal_exponent, max_decimal_exponent>;
+						if (unsigned(k - hot_range_cache::min_k) < hot_range_cache::table_size) {
+							return hot_range_cache::cache.table[std::size_t(k - hot_range_cache::min_k)];
+						}
+						return compact::template get_cache<format>(k);
+					}
+				};
+
+				// Same as fast, but also looks up the results of the shorter interval case,
+				// that is, of the powers of 2, from a table.
+				struct shorter_interval_table {
+					using policy_kind = policy_kind::cache;
+					using cache_policy = shorter_interval_table;
+					static constexpr bool has_shorter_interval_table = true;
+
+					template <ieee754_format format>
+					static constexpr typename dragonbox::cache_holder<format>::cache_entry_type
+						get_cache(int k) noexcept
+					{
+						return fast::template get_cache<format>(k);
+					}
+
+					template <ieee754_format format>
+					static constexpr typename dragonbox::shorter_interval_table_holder<format>::entry_type
+						get_shorter_interval_entry(unsigned int exponent_bits) noexcept
+					{
+						using holder = dragonbox::shorter_interval_table_holder<format>;
+						assert(exponent_bits >= 1 &&
+							exponent_bits <= sizeof(holder::table) / sizeof(holder::table[0]));
+						return holder::table[exponent_bits - 1];
+					}
+				};
 			}
 
 			namespace input_validation {
 				struct assert_finite {
 					using policy_kind = policy_kind::input_validation;
 					using input_validation_policy = assert_finite;
+					static constexpr bool returns_value_class = false;
+
 					template <class Float>
 					static void validate_input([[maybe_unused]] ieee754_bits<Float> br) noexcept
 					{
@@ -981,9 +1040,71 @@ namespace jkj::fp {
 				struct do_nothing {
 					using policy_kind = policy_kind::input_validation;
 					using input_validation_policy = do_nothing;
+					static constexpr bool returns_value_class = false;
+
 					template <class Float>
 					static void validate_input(ieee754_bits<Float>) noexcept {}
 				};
+
+				// Accepts any input and returns classified_decimal_fp instead.
+				// Normal numbers are classified with a single comparison.
+				struct classify {
+					using policy_kind = policy_kind::input_validation;
+					using input_validation_policy = classify;
+					static constexpr bool returns_value_class = true;
+
+					template <class Float>
+					static constexpr value_class classify_input(ieee754_bits<Float> br) noexcept
+					{
+						constexpr auto max_exponent_bits = (1u << ieee754_format_info<
+							ieee754_traits<Float>::format>::exponent_bits) - 1;
+
+						auto const exponent_bits = br.extract_exponent_bits();
+						if (exponent_bits - 1 < max_exponent_bits - 1) {
+							return value_class::finite;
+						}
+						else if (exponent_bits == 0) {
+							return br.extract_significand_bits() == 0 ?
+								value_class::zero : value_class::finite;
+						}
+						else {
+							return br.extract_significand_bits() == 0 ?
+								value_class::infinity : value_class::nan;
+						}
+					}
+				};
+			}
+
+			namespace integer_check {
+				// Integers small enough that all of their digits are significant are
+				// converted without the cache.
+				struct fast_path {
+					using policy_kind = policy_kind::integer_check;
+					using integer_check_policy = fast_path;
+					static constexpr bool check_integers = true;
+				};
+
+				struct do_nothing {
+					using policy_kind = policy_kind::integer_check;
+					using integer_check_policy = do_nothing;
+					static constexpr bool check_integers = false;
+				};
+			}
+
+			namespace branch_strategy {
+				struct branchy {
+					using policy_kind = policy_kind::branch_strategy;
+					using branch_strategy_policy = branchy;
+					static constexpr bool is_branchless = false;
+				};
+
+				// Computes both of the candidates of the nearest rounding and selects one,
+				// at the cost of a few more multiplications.
+				struct branchless {
+					using policy_kind = policy_kind::branch_strategy;
+					using branch_strategy_policy = branchless;
+					static constexpr bool is_branchless = true;
+				};
 			}
 		}
 	}
@@ -1049,6 +1170,11 @@ namespace jkj::fp {
 		namespace cache {
 			static constexpr auto fast = detail::policy::cache::fast{};
 			static constexpr auto compact = detail::policy::cache::compact{};
+			static constexpr auto shorter_interval_table =
+				detail::policy::cache::shorter_interval_table{};
+			template <int min_decimal_exponent, int max_decimal_exponent>
+			static constexpr auto hot_range =
+				detail::policy::cache::hot_range<min_decimal_exponent, max_decimal_exponent>{};
 		}
 
 		namespace input_validation {
@@ -1056,6 +1182,18 @@ namespace jkj::fp {
 				detail::policy::input_validation::assert_finite{};
 			static constexpr auto do_nothing =
 				detail::policy::input_validation::do_nothing{};
+			static constexpr auto classify =
+				detail::policy::input_validation::classify{};
+		}
+
+		namespace integer_check {
+			static constexpr auto fast_path = detail::policy::integer_check::fast_path{};
+			static constexpr auto do_nothing = detail::policy::integer_check::do_nothing{};
+		}
+
+		namespace branch_strategy {
+			static constexpr auto branchy = detail::policy::branch_strategy::branchy{};
+			static constexpr auto branchless = detail::policy::branch_strategy::branchless{};
 		}
 	}
 }
@@ -0,0 +1,407 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#ifndef JKJ_HEADER_FP_SCALED_DECIMAL
+#define JKJ_HEADER_FP_SCALED_DECIMAL
+
+#include "dooly.h"
+#include "ieee754_format.h"
+#include "policy.h"
+#include "ryu_printf.h"
+#include "detail/bits.h"
+#include "detail/log.h"
+#include "detail/util.h"
+#include "detail/wuint.h"
+#include "detail/macros.h"
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace jkj::fp {
+	struct scaled_decimal_result {
+		std::int64_t value;
+		// True if the result does not fit in std::int64_t, or the input is not finite;
+		// value is then unspecified.
+		bool is_overflow;
+	};
+
+	namespace detail {
+		namespace scaled_decimal {
+			template <class Float>
+			struct impl {
+				using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
+				using format_info = ieee754_format_info<ieee754_traits<Float>::format>;
+
+				// The largest power of 5 fitting in 63 bits.
+				static constexpr int max_exact_power_of_5 = 27;
+
+				// Rounds the magnitude truncated to an integer, given the rest.
+				// Returns false on overflow.
+				template <class DecimalRoundingPolicy>
+				JKJ_FORCEINLINE static bool round(std::uint64_t& magnitude, std::uint64_t limit,
+					bool is_above_half, bool is_half) noexcept
+				{
+					using tag_t = policy::decimal_rounding::tag_t;
+					constexpr auto tag = DecimalRoundingPolicy::tag;
+					bool round_up = is_above_half;
+					if (is_half) {
+						if constexpr (tag == tag_t::to_even) {
+							round_up = magnitude % 2 != 0;
+						}
+						else if constexpr (tag == tag_t::to_odd) {
+							round_up = magnitude % 2 == 0;
+						}
+						else if constexpr (tag == tag_t::toward_zero) {
+							round_up = false;
+						}
+						else {
+							round_up = true;
+						}
+					}
+					if (magnitude > limit || (round_up && magnitude == limit)) {
+						return false;
+					}
+					magnitude += (round_up ? 1 : 0);
+					return true;
+				}
+
+				// When 0 <= -exponent <= max_exact_power_of_5, x * 10^(-exponent) is
+				// f * 5^(-exponent) * 2^(e - exponent), whose first factor fits in 128 bits.
+				template <class DecimalRoundingPolicy>
+				JKJ_FORCEINLINE static bool compute_exact(carrier_uint f, int e, int exponent,
+					std::uint64_t limit, std::uint64_t& magnitude) noexcept
+				{
+					constexpr auto const& pow5 =
+						pow_table<std::uint64_t, 5, max_exact_power_of_5 + 1>::table;
+					auto const product = wuint::umul128(f, pow5[-exponent]);
+					auto const shift = -(e - exponent);
+
+					if (shift <= 0) {
+						// Integer; no rounding.
+						if (product.high() != 0 || -shift >= 64 ||
+							(product.low() >> (63 + shift)) > 1)
+						{
+							return false;
+						}
+						magnitude = product.low() << -shift;
+						return magnitude <= limit;
+					}
+					else if (shift >= 128) {
+						// Less than 2^116 / 2^128.
+						magnitude = 0;
+						return true;
+					}
+
+					// The integer part, the bit right below it, and the bits below that.
+					if (shift < 64) {
+						if ((product.high() >> shift) != 0) {
+							return false;
+						}
+						magnitude = (product.high() << (64 - shift)) | (product.low() >> shift);
+					}
+					else {
+						magnitude = product.high() >> (shift - 64);
+					}
+					auto const half_pos = shift - 1;
+					bool half_bit, has_lower_bits;
+					if (half_pos >= 64) {
+						half_bit = ((product.high() >> (half_pos - 64)) & 1) != 0;
+						has_lower_bits = product.low() != 0 ||
+							(product.high() & ((std::uint64_t(1) << (half_pos - 64)) - 1)) != 0;
+					}
+					else {
+						half_bit = ((product.low() >> half_pos) & 1) != 0;
+						has_lower_bits =
+							(product.low() & ((std::uint64_t(1) << half_pos) - 1)) != 0;
+					}
+					return round<DecimalRoundingPolicy>(magnitude, limit,
+						half_bit && has_lower_bits, half_bit && !has_lower_bits);
+				}
+
+				// Reads the digits of x up to 10^exponent, using Ryu-printf.
+				template <class DecimalRoundingPolicy>
+				static bool compute_general(ieee754_bits<Float> br, int exponent,
+					std::uint64_t limit, std::uint64_t& magnitude) noexcept
+				{
+					using digit_generator = fp::ryu_printf<Float>;
+					constexpr auto segment_size = digit_generator::segment_size;
+					constexpr auto const& pow10 = pow_table<std::uint64_t, 10, segment_size + 1>::table;
+					constexpr auto max_before_last_segment =
+						std::uint64_t(-1) / pow10[segment_size];
+
+					// The digit right below 10^exponent, that is, at 10^(exponent - 1),
+					// belongs to the segment with index last_index, and the digits of
+					// the segment above that digit belong to the integer part.
+					// Avoid signed division.
+					int const dividend = 1 - exponent;
+					int const last_index = dividend > 0 ?
+						int((unsigned(dividend) + segment_size - 1) / unsigned(segment_size)) :
+						-int(unsigned(-dividend) / unsigned(segment_size));
+					int const integer_digits = segment_size * (1 - last_index) - exponent;
+					assert(integer_digits >= 0 && integer_digits < segment_size);
+
+					digit_generator digit_gen{ br };
+					magnitude = 0;
+					if (digit_gen.current_segment_index() > last_index) {
+						// Less than 10^(exponent - 1).
+						return true;
+					}
+
+					while (digit_gen.current_segment_index() < last_index) {
+						if (magnitude >= max_before_last_segment) {
+							return false;
+						}
+						magnitude = magnitude * pow10[segment_size] + digit_gen.current_segment();
+						digit_gen.compute_next_segment();
+					}
+
+					auto const divisor = pow10[segment_size - integer_digits];
+					auto const last_segment = digit_gen.current_segment();
+					auto const integer_part = last_segment / divisor;
+					auto const remainder = last_segment % divisor;
+					if (magnitude > (std::uint64_t(-1) - integer_part) / pow10[integer_digits]) {
+						return false;
+					}
+					magnitude = magnitude * pow10[integer_digits] + integer_part;
+
+					bool is_above_half = remainder > divisor / 2;
+					bool is_half = false;
+					if (remainder == divisor / 2) {
+						if constexpr (DecimalRoundingPolicy::tag ==
+							policy::decimal_rounding::tag_t::do_not_care)
+						{
+							is_above_half = true;
+						}
+						else {
+							is_above_half = digit_gen.has_further_nonzero_segments();
+							is_half = !is_above_half;
+						}
+					}
+					return round<DecimalRoundingPolicy>(magnitude, limit, is_above_half, is_half);
+				}
+
+				template <class DecimalRoundingPolicy>
+				JKJ_FORCEINLINE static scaled_decimal_result compute(ieee754_bits<Float> br, int exponent) noexcept
+				{
+					if (!br.is_finite()) {
+						return{ 0, true };
+					}
+
+					bool const is_negative = br.is_negative();
+					// The magnitude of std::numeric_limits<std::int64_t>::min() is one larger.
+					auto const limit = (std::uint64_t(1) << 63) - (is_negative ? 0 : 1);
+
+					auto f = br.extract_significand_bits();
+					auto const exponent_bits = br.extract_exponent_bits();
+					int e;
+					if (exponent_bits != 0) {
+						f |= (carrier_uint(1) << format_info::significand_bits);
+						e = int(exponent_bits) + format_info::exponent_bias
+							- format_info::significand_bits;
+					}
+					else {
+						if (f == 0) {
+							return{ 0, false };
+						}
+						e = format_info::min_exponent - format_info::significand_bits;
+					}
+
+					std::uint64_t magnitude;
+					bool const success = exponent <= 0 && exponent >= -max_exact_power_of_5 ?
+						compute_exact<DecimalRoundingPolicy>(f, e, exponent, limit, magnitude) :
+						compute_general<DecimalRoundingPolicy>(
+							ieee754_bits<Float>{ br.u & ~ieee754_traits<Float>::negative_zero() },
+							exponent, limit, magnitude);
+					if (!success) {
+						return{ 0, true };
+					}
+					return{ is_negative ? std::int64_t(std::uint64_t(0) - magnitude) :
+						std::int64_t(magnitude), false };
+				}
+			};
+		}
+	}
+
+	// Computes the integer n closest to x * 10^(-exponent), so that n * 10^exponent
+	// approximates x; e.g., exponent = -6 gives x in micro-units.
+	// The result is correctly rounded, and ties are broken according to the
+	// decimal rounding policy (to_even by default), applied to the magnitude.
+	template <class Float, class... Policies>
+	scaled_decimal_result to_scaled_decimal(Float x, int exponent, Policies&&... policies) noexcept
+	{
+		// Build policy holder type
+		using namespace policy;
+		using detail::policy::make_policy_holder;
+		using detail::policy::make_default_list;
+		using detail::policy::make_default;
+		using policy_holder_t = decltype(make_policy_holder(
+			make_default_list(
+				make_default<policy_kind::decimal_rounding>(decimal_rounding::to_even)),
+			std::forward<Policies>(policies)...));
+
+		return detail::scaled_decimal::impl<Float>::template compute<
+			typename policy_holder_t::decimal_rounding_policy>(ieee754_bits<Float>{ x }, exponent);
+	}
+
+	namespace detail {
+		namespace scaled_decimal {
+			// The floating-point number nearest to the rounding of x to a multiple of
+			// 10^exponent, given by to_scaled_decimal. When the rounding has too many
+			// digits for the carrier type, it is at least 10 digits long and the
+			// nearest floating-point number is x itself.
+			template <class Float>
+			Float snap(Float x, scaled_decimal_result rounded, int exponent) noexcept
+			{
+				using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
+				if (rounded.is_overflow) {
+					return x;
+				}
+				auto const magnitude = rounded.value < 0 ?
+					std::uint64_t(0) - std::uint64_t(rounded.value) : std::uint64_t(rounded.value);
+				if (magnitude > std::numeric_limits<carrier_uint>::max()) {
+					return x;
+				}
+
+				signed_decimal_fp<Float> decimal;
+				decimal.significand = carrier_uint(magnitude);
+				decimal.exponent = exponent;
+				decimal.is_negative = ieee754_bits<Float>{ x }.is_negative();
+				return to_binary_limited_precision(decimal).to_float();
+			}
+		}
+	}
+
+	// Rounds x to decimal_places digits after the decimal point, and then returns the
+	// floating-point number nearest to that, so the result prints with at most that
+	// many digits. decimal_places can be negative; -2 rounds to a multiple of 100.
+	// Ties are broken according to the decimal rounding policy, as in to_scaled_decimal.
+	// Infinities and NaN's are returned as they are, and so is the sign of zero.
+	template <class Float, class... Policies>
+	Float round_to_decimal_places(Float x, int decimal_places, Policies&&... policies) noexcept
+	{
+		return detail::scaled_decimal::snap(x,
+			to_scaled_decimal(x, -decimal_places, std::forward<Policies>(policies)...),
+			-decimal_places);
+	}
+
+	// Rounds x to significant_digits significant decimal digits, and then returns
+	// the floating-point number nearest to that.
+	template <class Float, class... Policies>
+	Float round_to_significant(Float x, int significant_digits, Policies&&... policies) noexcept
+	{
+		assert(significant_digits > 0);
+		using format_info = ieee754_format_info<ieee754_traits<Float>::format>;
+
+		// With this many digits, x is the nearest one.
+		if (significant_digits >=
+			to_binary_limited_precision_digit_limit<ieee754_traits<Float>::format>)
+		{
+			return x;
+		}
+
+		ieee754_bits<Float> const br{ x };
+		if (!br.is_finite() || (br.u << 1) == 0) {
+			return x;
+		}
+
+		// floor(log10(|x|)) is either k or k + 1.
+		auto const exponent_bits = br.extract_exponent_bits();
+		int const floor_log2 = exponent_bits != 0 ?
+			int(exponent_bits) + format_info::exponent_bias :
+			format_info::min_exponent - format_info::significand_bits
+			+ int(ieee754_traits<Float>::carrier_bits) - 1
+			- detail::bits::countl_zero(br.extract_significand_bits());
+		int exponent = detail::log::floor_log10_pow2(floor_log2) - significant_digits + 1;
+
+		// If the rounding has one more digit, then either floor(log10(|x|)) is k + 1, or
+		// it is rounded up to 10^significant_digits. In both cases, rounding again at
+		// the next digit gives the answer.
+		auto rounded = to_scaled_decimal(x, exponent, policies...);
+		auto const magnitude = rounded.value < 0 ?
+			std::uint64_t(0) - std::uint64_t(rounded.value) : std::uint64_t(rounded.value);
+		constexpr auto const& pow10 = detail::pow_table<std::uint64_t, 10,
+			to_binary_limited_precision_digit_limit<ieee754_traits<Float>::format>>::table;
+		if (magnitude >= pow10[significant_digits]) {
+			++exponent;
+			rounded = to_scaled_decimal(x, exponent, policies...);
+		}
+		assert(!rounded.is_overflow);
+		return detail::scaled_decimal::snap(x, rounded, exponent);
+	}
+
+	// Applies round_to_decimal_places to each of [first, last), and stores the results
+	// to out. Returns one past the last number stored.
+	// When decimal_places allows Clinger's fast path, the choice of the path and the
+	// power of 10 are hoisted out of the loop, and the conversion back to binary
+	// is done inline for the roundings with at most as many bits as the significand.
+	template <class Float, class... Policies>
+	Float* round_to_decimal_places_batch(Float const* first, Float const* last,
+		int decimal_places, Float* out, Policies&&... policies) noexcept
+	{
+		// Build policy holder type
+		using namespace policy;
+		using detail::policy::make_policy_holder;
+		using detail::policy::make_default_list;
+		using detail::policy::make_default;
+		using policy_holder_t = decltype(make_policy_holder(
+			make_default_list(
+				make_default<policy_kind::decimal_rounding>(decimal_rounding::to_even)),
+			std::forward<Policies>(policies)...));
+
+		using impl = detail::scaled_decimal::impl<Float>;
+		using dooly_impl = detail::dooly::impl<Float>;
+		using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
+		using signed_int = std::make_signed_t<carrier_uint>;
+
+		if constexpr (dooly_impl::has_exact_fast_path) {
+			// In this range, to_scaled_decimal always takes the exact path.
+			static_assert(dooly_impl::max_exact_power_of_10 <= impl::max_exact_power_of_5);
+			if (decimal_places >= 0 && decimal_places <= dooly_impl::max_exact_power_of_10) {
+				auto const power_of_10 = dooly_impl::exact_pow10_table::table[decimal_places];
+				for (; first != last; ++first, ++out) {
+					ieee754_bits<Float> const br{ *first };
+					auto const rounded = impl::template compute<
+						typename policy_holder_t::decimal_rounding_policy>(br, -decimal_places);
+					auto const magnitude = rounded.value < 0 ?
+						std::uint64_t(0) - std::uint64_t(rounded.value) :
+						std::uint64_t(rounded.value);
+					if (rounded.is_overflow || magnitude > dooly_impl::max_exact_significand) {
+						*out = detail::scaled_decimal::snap(*first, rounded, -decimal_places);
+						continue;
+					}
+
+					// The magnitude is converted as a signed integer, which is cheaper.
+					auto result = ieee754_bits<Float>{
+						Float(signed_int(magnitude)) / power_of_10 }.u;
+					result |= (br.u & ieee754_traits<Float>::negative_zero());
+					*out = ieee754_traits<Float>::carrier_to_float(result);
+				}
+				return out;
+			}
+		}
+
+		for (; first != last; ++first, ++out) {
+			*out = round_to_decimal_places(*first, decimal_places, policies...);
+		}
+		return out;
+	}
+}
+
+#include "detail/undef_macros.h"
+#endif
@@ -0,0 +1,231 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#ifndef JKJ_HEADER_FP_TO_CHARS_HEXADECIMAL
+#define JKJ_HEADER_FP_TO_CHARS_HEXADECIMAL
+
+#include "../ieee754_format.h"
+#include "../detail/bits.h"
+#include "to_chars_common.h"
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace jkj::fp {
+	namespace detail {
+		namespace hex {
+			// Writes the 8 nibbles of x, the most significant one first,
+			// as lowercase hexadecimal digits.
+			inline void print_8_nibbles(char* buffer, std::uint32_t x) noexcept {
+				// Spread nibbles into bytes so that the most significant nibble
+				// goes to the lowest byte.
+				auto v = std::uint64_t(x >> 16) | (std::uint64_t(x & 0xffff) << 32);
+				v = ((v >> 8) & 0x0000'00ff'0000'00ff) | ((v & 0x0000'00ff'0000'00ff) << 16);
+				v = ((v >> 4) & 0x000f'000f'000f'000f) | ((v & 0x000f'000f'000f'000f) << 8);
+
+				// Bytes in [10,15] get an additional offset from '9' + 1 to 'a'.
+				constexpr auto ones = std::uint64_t(0x0101'0101'0101'0101);
+				auto const is_letter = ((v + ones * 6) >> 4) & ones;
+				v += ones * '0' + is_letter * ('a' - '0' - 10);
+
+				unsigned char bytes[8];
+				for (int i = 0; i < 8; ++i) {
+					bytes[i] = (unsigned char)(v >> (i * 8));
+				}
+				std::memcpy(buffer, bytes, 8);
+			}
+
+			// Writes the first count nibbles of x, the most significant one first.
+			inline char* print_nibbles(char* buffer, std::uint64_t x, int count) noexcept {
+				assert(count >= 0 && count <= 16);
+				char digits[16];
+				print_8_nibbles(digits, std::uint32_t(x >> 32));
+				if (count > 8) {
+					print_8_nibbles(digits + 8, std::uint32_t(x));
+				}
+				std::memcpy(buffer, digits, std::size_t(count));
+				return buffer + count;
+			}
+
+			inline char* print_exponent(char* buffer, int exponent) noexcept {
+				*buffer = 'p';
+				++buffer;
+				if (exponent < 0) {
+					*buffer = '-';
+					exponent = -exponent;
+				}
+				else {
+					*buffer = '+';
+				}
+				++buffer;
+
+				auto const uexp = unsigned(exponent);
+				assert(uexp < 10000);
+				if (uexp >= 1000) {
+					std::memcpy(buffer, &radix_100_table[(uexp / 100) * 2], 2);
+					std::memcpy(buffer + 2, &radix_100_table[(uexp % 100) * 2], 2);
+					return buffer + 4;
+				}
+				else if (uexp >= 100) {
+					*buffer = char('0' + uexp / 100);
+					std::memcpy(buffer + 1, &radix_100_table[(uexp % 100) * 2], 2);
+					return buffer + 3;
+				}
+				else if (uexp >= 10) {
+					std::memcpy(buffer, &radix_100_table[uexp * 2], 2);
+					return buffer + 2;
+				}
+				else {
+					*buffer = char('0' + uexp);
+					return buffer + 1;
+				}
+			}
+
+			template <class Float>
+			struct format_traits {
+				using format_info = ieee754_format_info<ieee754_traits<Float>::format>;
+				using carrier_uint = typename ieee754_traits<Float>::carrier_uint;
+
+				// The significand bits are left-padded so that they fill whole nibbles.
+				static constexpr int fraction_nibbles = (format_info::significand_bits + 3) / 4;
+				static constexpr int fraction_shift =
+					fraction_nibbles * 4 - format_info::significand_bits;
+				static_assert(fraction_nibbles <= 16);
+			};
+
+			// Prints the sign and special values; returns nullptr if x is finite and nonzero.
+			template <class Float>
+			char* print_special(ieee754_bits<Float> br, char*& buffer) noexcept {
+				using format_info = ieee754_format_info<ieee754_traits<Float>::format>;
+
+				if (br.is_negative()) {
+					*buffer = '-';
+					++buffer;
+				}
+				if (br.is_finite()) {
+					if (br.is_nonzero()) {
+						return nullptr;
+					}
+					std::memcpy(buffer, "0x0p+0", 6);
+					return buffer + 6;
+				}
+				if ((br.u << (format_info::exponent_bits + 1)) != 0) {
+					std::memcpy(buffer, "nan", 3);
+					return buffer + 3;
+				}
+				else {
+					std::memcpy(buffer, "inf", 3);
+					return buffer + 3;
+				}
+			}
+		}
+	}
+
+	// Exact hexadecimal formatting, as printf's %a does.
+	// Normal numbers are printed as 0x1.<fraction>p<exponent>, and subnormal numbers as
+	// 0x0.<fraction>p<minimum exponent>, with trailing zeros of the fraction removed.
+	// Infinities and NaN's are printed as inf and nan.
+	// This function does not null-terminate the buffer.
+	template <class Float>
+	char* to_chars_hex_n(Float x, char* buffer) noexcept {
+		using traits = detail::hex::format_traits<Float>;
+
+		auto const br = ieee754_bits<Float>(x);
+		if (auto const ptr = detail::hex::print_special(br, buffer); ptr != nullptr) {
+			return ptr;
+		}
+
+		auto const fraction = std::uint64_t(br.extract_significand_bits()) << traits::fraction_shift;
+		std::memcpy(buffer, br.extract_exponent_bits() == 0 ? "0x0" : "0x1", 3);
+		buffer += 3;
+
+		if (fraction != 0) {
+			*buffer = '.';
+			++buffer;
+			auto const number_of_nibbles =
+				traits::fraction_nibbles - detail::bits::countr_zero(fraction) / 4;
+			buffer = detail::hex::print_nibbles(buffer,
+				fraction << (64 - traits::fraction_nibbles * 4), number_of_nibbles);
+		}
+		return detail::hex::print_exponent(buffer, br.binary_exponent());
+	}
+
+	// Hexadecimal formatting with precision hexadecimal digits after the point.
+	// The significand is correctly rounded to nearest, ties to even, so the leading digit
+	// can become 2 for normal numbers or 1 for subnormal numbers.
+	// No decimal point is printed if precision is 0.
+	// This function does not null-terminate the buffer.
+	template <class Float>
+	char* to_chars_hex_n(Float x, char* buffer, int precision) noexcept {
+		using traits = detail::hex::format_traits<Float>;
+		assert(precision >= 0);
+
+		auto const br = ieee754_bits<Float>(x);
+		if (auto const ptr = detail::hex::print_special(br, buffer); ptr != nullptr) {
+			return ptr;
+		}
+
+		auto significand = std::uint64_t(br.binary_significand()) << traits::fraction_shift;
+		auto number_of_nibbles = traits::fraction_nibbles;
+
+		if (precision < traits::fraction_nibbles) {
+			auto const dropped_bits = (traits::fraction_nibbles - precision) * 4;
+			auto const half = std::uint64_t(1) << (dropped_bits - 1);
+			auto const remainder = significand & ((half << 1) - 1);
+			significand >>= dropped_bits;
+			if (remainder > half || (remainder == half && (significand % 2) != 0)) {
+				++significand;
+			}
+			number_of_nibbles = precision;
+		}
+
+		std::memcpy(buffer, "0x", 2);
+		*(buffer + 2) = char('0' + (significand >> (number_of_nibbles * 4)));
+		buffer += 3;
+
+		if (precision != 0) {
+			*buffer = '.';
+			++buffer;
+			if (number_of_nibbles != 0) {
+				buffer = detail::hex::print_nibbles(buffer,
+					significand << (64 - number_of_nibbles * 4), number_of_nibbles);
+			}
+			if (precision > number_of_nibbles) {
+				buffer = detail::print_zeros(buffer, precision - number_of_nibbles);
+			}
+		}
+		return detail::hex::print_exponent(buffer, br.binary_exponent());
+	}
+
+	// Same as to_chars_hex_n, but null-terminates the buffer.
+	// Returns the pointer to the added null character.
+	template <class Float>
+	char* to_chars_hex(Float x, char* buffer) noexcept {
+		auto ptr = to_chars_hex_n(x, buffer);
+		*ptr = '\0';
+		return ptr;
+	}
+
+	template <class Float>
+	char* to_chars_hex(Float x, char* buffer, int precision) noexcept {
+		auto ptr = to_chars_hex_n(x, buffer, precision);
+		*ptr = '\0';
+		return ptr;
+	}
+}
+
+#endif
@@ -0,0 +1,83 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+
+#ifndef JKJ_HEADER_FP_TO_CHARS_RUNTIME_POLICY
+#define JKJ_HEADER_FP_TO_CHARS_RUNTIME_POLICY
+
+#include "../decimal_fp.h"
+
+namespace jkj::fp {
+	// Policies chosen at runtime, each of them corresponding to the policy of the same name.
+	// The overloads below taking a runtime_policy call, through a table of function pointers
+	// compiled into jkj_fp_charconv, the instance of the policy-based interface
+	// specialized for the given combination. The sign is always propagated.
+	struct runtime_policy {
+		enum class binary_rounding_t : unsigned char {
+			nearest_to_even,
+			nearest_to_odd,
+			nearest_toward_plus_infinity,
+			nearest_toward_minus_infinity,
+			nearest_toward_zero,
+			nearest_away_from_zero,
+			toward_plus_infinity,
+			toward_minus_infinity,
+			toward_zero,
+			away_from_zero
+		};
+
+		// Ignored for the directed roundings.
+		enum class decimal_rounding_t : unsigned char {
+			do_not_care,
+			to_even,
+			to_odd,
+			away_from_zero,
+			toward_zero
+		};
+
+		enum class trailing_zero_t : unsigned char {
+			allow,
+			remove
+		};
+
+		enum class cache_t : unsigned char {
+			fast,
+			compact
+		};
+
+		binary_rounding_t	binary_rounding = binary_rounding_t::nearest_to_even;
+		decimal_rounding_t	decimal_rounding = decimal_rounding_t::to_even;
+		trailing_zero_t		trailing_zero = trailing_zero_t::remove;
+		cache_t				cache = cache_t::fast;
+	};
+
+	// Same as to_shortest_decimal with sign::propagate and input_validation::classify.
+	classified_decimal_fp<signed_decimal_fp<float>> to_shortest_decimal(float x,
+		runtime_policy policy);
+	classified_decimal_fp<signed_decimal_fp<double>> to_shortest_decimal(double x,
+		runtime_policy policy);
+
+	// Returns the next-to-end position.
+	char* to_chars_shortest_scientific_n(float x, char* buffer, runtime_policy policy);
+	char* to_chars_shortest_scientific_n(double x, char* buffer, runtime_policy policy);
+
+	// Null-terminates and bypass the return value of fp_to_chars_n.
+	char* to_chars_shortest_scientific(float x, char* buffer, runtime_policy policy);
+	char* to_chars_shortest_scientific(double x, char* buffer, runtime_policy policy);
+}
+
+#endif
@@ -24,6 +24,34 @@ namespace jkj::fp {
 	namespace detail {
 		char* to_chars_shortest_scientific_n_impl(unsigned_decimal_fp<float> v, char* buffer);
 		char* to_chars_shortest_scientific_n_impl(unsigned_decimal_fp<double> v, char* buffer);
+
+		// Prints the result of to_shortest_decimal with input_validation::classify.
+		template <class Float>
+		char* to_chars_shortest_scientific_n_impl(
+			classified_decimal_fp<signed_decimal_fp<Float>> const& v, char* buffer)
+		{
+			if (v.is_negative && v.classification != value_class::nan) {
+				*buffer = '-';
+				++buffer;
+			}
+			switch (v.classification) {
+			case value_class::finite:
+				return to_chars_shortest_scientific_n_impl(
+					unsigned_decimal_fp<Float>{ v.significand, v.exponent }, buffer);
+
+			case value_class::zero:
+				std::memcpy(buffer, "0E0", 3);
+				return buffer + 3;
+
+			case value_class::infinity:
+				std::memcpy(buffer, "Infinity", 8);
+				return buffer + 8;
+
+			default:
+				std::memcpy(buffer, "NaN", 3);
+				return buffer + 3;
+			}
+		}
 	}
 
 	// Returns the next-to-end position.
@@ -36,55 +64,120 @@ namespace jkj::fp {
 				make_default<policy_kind::trailing_zero>(policy::trailing_zero::remove),
 				make_default<policy_kind::binary_rounding>(policy::binary_rounding::nearest_to_even),
 				make_default<policy_kind::decimal_rounding>(policy::decimal_rounding::to_even),
+				make_default<policy_kind::cache>(policy::cache::fast),
+				make_default<policy_kind::integer_check>(policy::integer_check::do_nothing),
+				make_default<policy_kind::branch_strategy>(policy::branch_strategy::branchy)),
+			std::forward<Policies>(policies)...));
+
+		static_assert(!policy_holder_t::report_trailing_zeros,
+			"jkj::fp::policy::trailing_zero::report is not valid for to_chars & to_chars_n");
+
+		// The sign and the class of x are read by to_shortest_decimal.
+		return detail::to_chars_shortest_scientific_n_impl(to_shortest_decimal(x,
+			policy::sign::propagate, policy::input_validation::classify,
+			std::forward<Policies>(policies)...),
+			buffer);
+	}
+
+	// Null-terminates and bypass the return value of fp_to_chars_n.
+	template <class Float, class... Policies>
+	char* to_chars_shortest_scientific(Float x, char* buffer, Policies... policies)
+	{
+		auto ptr = to_chars_shortest_scientific_n(x, buffer, policies...);
+		*ptr = '\0';
+		return ptr;
+	}
+
+	// Prints an enclosure of [lower, upper] with to_shortest_decimal_enclosure.
+	// When the two bounds share the exponent and some leading digits, the common
+	// prefix is printed only once, as in 1.2345[6,7]E3; otherwise prints [lower,upper].
+	// Returns the next-to-end position.
+	template <class Float, class... Policies>
+	char* to_chars_shortest_enclosure_n(Float lower, Float upper, char* buffer,
+		Policies&&... policies)
+	{
+		using namespace jkj::fp::detail::policy;
+		using policy_holder_t = decltype(make_policy_holder(
+			make_default_list(
+				make_default<policy_kind::trailing_zero>(policy::trailing_zero::remove),
 				make_default<policy_kind::cache>(policy::cache::fast)),
 			std::forward<Policies>(policies)...));
 
 		static_assert(!policy_holder_t::report_trailing_zeros,
 			"jkj::fp::policy::trailing_zero::report is not valid for to_chars & to_chars_n");
 
-		using ieee754_format_info = ieee754_format_info<ieee754_traits<Float>::format>;
+		auto const enclosure = to_shortest_decimal_enclosure(lower, upper,
+			policy::sign::propagate, std::forward<Policies>(policies)...);
 
-		auto br = ieee754_bits(x);
-		if (br.is_finite()) {
-			if (br.is_negative()) {
-				*buffer = '-';
-				++buffer;
+		// Enough for the sign, the digits, the decimal point, and the exponent.
+		constexpr std::size_t max_length = 32;
+		char bounds[2][max_length];
+		char* bound_ends[2];
+		decltype(enclosure.lower) const decimals[2] = { enclosure.lower, enclosure.upper };
+		for (int i = 0; i < 2; ++i) {
+			auto ptr = bounds[i];
+			if (decimals[i].is_negative) {
+				*ptr = '-';
+				++ptr;
 			}
-			if (br.is_nonzero()) {
-				return detail::to_chars_shortest_scientific_n_impl(to_shortest_decimal(x,
-					policy::sign::ignore,
-					std::forward<Policies>(policies)...),
-					buffer);
+			if (decimals[i].significand != 0) {
+				bound_ends[i] = detail::to_chars_shortest_scientific_n_impl(
+					unsigned_decimal_fp<Float>{ decimals[i].significand, decimals[i].exponent }, ptr);
 			}
 			else {
-				std::memcpy(buffer, "0E0", 3);
-				return buffer + 3;
+				std::memcpy(ptr, "0E0", 3);
+				bound_ends[i] = ptr + 3;
 			}
 		}
-		else {
-			if ((br.u << (ieee754_format_info::exponent_bits + 1)) != 0)
-			{
-				std::memcpy(buffer, "NaN", 3);
-				return buffer + 3;
+
+		// Split each bound into the digits and the exponent part.
+		char const* exponent_positions[2];
+		for (int i = 0; i < 2; ++i) {
+			exponent_positions[i] = bounds[i];
+			while (*exponent_positions[i] != 'E') {
+				++exponent_positions[i];
 			}
-			else {
-				if (br.is_negative()) {
-					*buffer = '-';
-					++buffer;
-				}
-				std::memcpy(buffer, "Infinity", 8);
-				return buffer + 8;
+		}
+		auto const lower_digits_length = std::size_t(exponent_positions[0] - bounds[0]);
+		auto const upper_digits_length = std::size_t(exponent_positions[1] - bounds[1]);
+		auto const exponent_length = std::size_t(bound_ends[0] - exponent_positions[0]);
+
+		std::size_t prefix_length = 0;
+		if (exponent_length == std::size_t(bound_ends[1] - exponent_positions[1]) &&
+			std::memcmp(exponent_positions[0], exponent_positions[1], exponent_length) == 0)
+		{
+			while (prefix_length < lower_digits_length && prefix_length < upper_digits_length &&
+				bounds[0][prefix_length] == bounds[1][prefix_length])
+			{
+				++prefix_length;
 			}
 		}
-	}
 
-	// Null-terminates and bypass the return value of fp_to_chars_n.
-	template <class Float, class... Policies>
-	char* to_chars_shortest_scientific(Float x, char* buffer, Policies... policies)
-	{
-		auto ptr = to_chars_shortest_scientific_n(x, buffer, policies...);
-		*ptr = '\0';
-		return ptr;
+		// The prefix should contain a digit, and both bounds should have more digits.
+		if (prefix_length == 0 || bounds[0][prefix_length - 1] == '-' ||
+			prefix_length == lower_digits_length || prefix_length == upper_digits_length)
+		{
+			*buffer = '[';
+			std::memcpy(buffer + 1, bounds[0], std::size_t(bound_ends[0] - bounds[0]));
+			buffer += 1 + (bound_ends[0] - bounds[0]);
+			*buffer = ',';
+			std::memcpy(buffer + 1, bounds[1], std::size_t(bound_ends[1] - bounds[1]));
+			buffer += 1 + (bound_ends[1] - bounds[1]);
+			*buffer = ']';
+			return buffer + 1;
+		}
+
+		std::memcpy(buffer, bounds[0], prefix_length);
+		buffer += prefix_length;
+		*buffer = '[';
+		std::memcpy(buffer + 1, bounds[0] + prefix_length, lower_digits_length - prefix_length);
+		buffer += 1 + (lower_digits_length - prefix_length);
+		*buffer = ',';
+		std::memcpy(buffer + 1, bounds[1] + prefix_length, upper_digits_length - prefix_length);
+		buffer += 1 + (upper_digits_length - prefix_length);
+		*buffer = ']';
+		std::memcpy(buffer + 1, exponent_positions[0], exponent_length);
+		return buffer + 1 + exponent_length;
 	}
 }
 
@@ -0,0 +1,171 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+
+#include "jkj/fp/to_chars/runtime_policy.h"
+#include "jkj/fp/to_chars/shortest_roundtrip.h"
+#include <array>
+#include <cassert>
+#include <tuple>
+#include <utility>
+
+namespace jkj::fp {
+	namespace detail {
+		namespace {
+			// In the order of the enumerators of runtime_policy.
+			using binary_rounding_policies = std::tuple<
+				policy::binary_rounding::nearest_to_even,
+				policy::binary_rounding::nearest_to_odd,
+				policy::binary_rounding::nearest_toward_plus_infinity,
+				policy::binary_rounding::nearest_toward_minus_infinity,
+				policy::binary_rounding::nearest_toward_zero,
+				policy::binary_rounding::nearest_away_from_zero,
+				policy::binary_rounding::toward_plus_infinity,
+				policy::binary_rounding::toward_minus_infinity,
+				policy::binary_rounding::toward_zero,
+				policy::binary_rounding::away_from_zero>;
+
+			using decimal_rounding_policies = std::tuple<
+				policy::decimal_rounding::do_not_care,
+				policy::decimal_rounding::to_even,
+				policy::decimal_rounding::to_odd,
+				policy::decimal_rounding::away_from_zero,
+				policy::decimal_rounding::toward_zero>;
+
+			using trailing_zero_policies = std::tuple<
+				policy::trailing_zero::allow,
+				policy::trailing_zero::remove>;
+
+			using cache_policies = std::tuple<
+				policy::cache::fast,
+				policy::cache::compact>;
+
+			template <class Tuple>
+			constexpr std::size_t size_of = std::tuple_size_v<Tuple>;
+
+			constexpr std::size_t runtime_policy_table_size =
+				size_of<binary_rounding_policies> * size_of<decimal_rounding_policies> *
+				size_of<trailing_zero_policies> * size_of<cache_policies>;
+
+			constexpr std::size_t runtime_policy_index(runtime_policy policy) noexcept {
+				auto const index =
+					((std::size_t(policy.binary_rounding) * size_of<decimal_rounding_policies> +
+						std::size_t(policy.decimal_rounding)) * size_of<trailing_zero_policies> +
+						std::size_t(policy.trailing_zero)) * size_of<cache_policies> +
+					std::size_t(policy.cache);
+				assert(index < runtime_policy_table_size);
+				return index;
+			}
+
+			// The policies for the entry of the given index. The decimal rounding policy has
+			// no effect on the directed roundings, so they share the instances with to_even.
+			template <std::size_t index>
+			struct runtime_policy_entry {
+				static constexpr std::size_t cache_index = index % size_of<cache_policies>;
+				static constexpr std::size_t trailing_zero_index =
+					index / size_of<cache_policies> % size_of<trailing_zero_policies>;
+				static constexpr std::size_t decimal_rounding_index =
+					index / (size_of<cache_policies> * size_of<trailing_zero_policies>) %
+					size_of<decimal_rounding_policies>;
+				static constexpr std::size_t binary_rounding_index =
+					index / (size_of<cache_policies> * size_of<trailing_zero_policies> *
+						size_of<decimal_rounding_policies>);
+				static constexpr bool is_directed = binary_rounding_index >=
+					std::size_t(runtime_policy::binary_rounding_t::toward_plus_infinity);
+
+				using binary_rounding_policy =
+					std::tuple_element_t<binary_rounding_index, binary_rounding_policies>;
+				using decimal_rounding_policy = std::tuple_element_t<is_directed ?
+					std::size_t(runtime_policy::decimal_rounding_t::to_even) :
+					decimal_rounding_index, decimal_rounding_policies>;
+				using trailing_zero_policy =
+					std::tuple_element_t<trailing_zero_index, trailing_zero_policies>;
+				using cache_policy = std::tuple_element_t<cache_index, cache_policies>;
+			};
+
+			template <class Float>
+			using runtime_policy_result = classified_decimal_fp<signed_decimal_fp<Float>>;
+
+			template <class Float>
+			using runtime_policy_function = runtime_policy_result<Float>(*)(Float);
+
+			template <class Float, class... Policies>
+			runtime_policy_result<Float> to_shortest_decimal_specialized(Float x) {
+				return to_shortest_decimal(x, policy::sign::propagate{},
+					policy::input_validation::classify{}, Policies{}...);
+			}
+
+			template <class Float, std::size_t index>
+			constexpr runtime_policy_function<Float> runtime_policy_table_entry() noexcept {
+				using entry = runtime_policy_entry<index>;
+				return &to_shortest_decimal_specialized<Float,
+					typename entry::binary_rounding_policy,
+					typename entry::decimal_rounding_policy,
+					typename entry::trailing_zero_policy,
+					typename entry::cache_policy>;
+			}
+
+			template <class Float, std::size_t... indices>
+			constexpr auto make_runtime_policy_table(std::index_sequence<indices...>) noexcept {
+				return std::array<runtime_policy_function<Float>, sizeof...(indices)>{
+					runtime_policy_table_entry<Float, indices>()...
+				};
+			}
+
+			template <class Float>
+			constexpr auto runtime_policy_table = make_runtime_policy_table<Float>(
+				std::make_index_sequence<runtime_policy_table_size>{});
+
+			template <class Float>
+			char* to_chars_shortest_scientific_n_runtime(Float x, char* buffer,
+				runtime_policy policy)
+			{
+				return to_chars_shortest_scientific_n_impl(
+					runtime_policy_table<Float>[runtime_policy_index(policy)](x), buffer);
+			}
+		}
+	}
+
+	classified_decimal_fp<signed_decimal_fp<float>> to_shortest_decimal(float x,
+		runtime_policy policy)
+	{
+		return detail::runtime_policy_table<float>[detail::runtime_policy_index(policy)](x);
+	}
+	classified_decimal_fp<signed_decimal_fp<double>> to_shortest_decimal(double x,
+		runtime_policy policy)
+	{
+		return detail::runtime_policy_table<double>[detail::runtime_policy_index(policy)](x);
+	}
+
+	char* to_chars_shortest_scientific_n(float x, char* buffer, runtime_policy policy) {
+		return detail::to_chars_shortest_scientific_n_runtime(x, buffer, policy);
+	}
+	char* to_chars_shortest_scientific_n(double x, char* buffer, runtime_policy policy) {
+		return detail::to_chars_shortest_scientific_n_runtime(x, buffer, policy);
+	}
+
+	char* to_chars_shortest_scientific(float x, char* buffer, runtime_policy policy) {
+		auto ptr = to_chars_shortest_scientific_n(x, buffer, policy);
+		*ptr = '\0';
+		return ptr;
+	}
+	char* to_chars_shortest_scientific(double x, char* buffer, runtime_policy policy) {
+		auto ptr = to_chars_shortest_scientific_n(x, buffer, policy);
+		*ptr = '\0';
+		return ptr;
+	}
+}
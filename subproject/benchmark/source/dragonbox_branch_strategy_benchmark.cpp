@@ -0,0 +1,123 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "random_float.h"
+#include "jkj/fp/dragonbox.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Unlike to_chars_shortest_roundtrip_benchmark, which repeats the conversion of
+// each sample, this converts arrays of samples at once, so that the branches on
+// the outcomes cannot be learned from the previous iterations.
+
+template <class Float, class Func>
+static double measure(std::vector<Float> const& samples, int number_of_iterations, Func&& func)
+{
+	std::uint64_t checksum = 0;
+	auto from = std::chrono::steady_clock::now();
+	for (int i = 0; i < number_of_iterations; ++i) {
+		for (auto const x : samples) {
+			checksum += func(x);
+		}
+	}
+	auto dur = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - from);
+	if (checksum == 1) {
+		std::cout << "\n";
+	}
+	return dur.count() / double(number_of_iterations) / double(samples.size());
+}
+
+template <class Float>
+static void benchmark_test(std::string_view float_name, std::size_t number_of_samples,
+	int number_of_iterations)
+{
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+
+	auto filename = std::string("results/dragonbox_branch_strategy_benchmark_");
+	filename += float_name;
+	filename += ".csv";
+	std::ofstream out_file{ filename };
+	out_file << "samples,name,ns\n";
+
+	auto run = [&](std::string const& samples_name, auto&& generate) {
+		std::vector<Float> samples(number_of_samples);
+		for (auto& x : samples) {
+			x = generate();
+		}
+
+		auto report = [&](char const* name, auto branch_strategy) {
+			auto const ns = measure(samples, number_of_iterations, [&](Float x) {
+				auto const result = jkj::fp::to_shortest_decimal(x, branch_strategy);
+				return std::uint64_t(result.significand) + std::uint64_t(result.exponent);
+			});
+			std::cout << samples_name << ", " << name << ": " << ns << " ns\n";
+			out_file << samples_name << "," << name << "," << ns << "\n";
+		};
+		report("branchy", jkj::fp::policy::branch_strategy::branchy);
+		report("branchless", jkj::fp::policy::branch_strategy::branchless);
+	};
+
+	run("uniformly random finite", [&] {
+		return jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+	});
+	run("uniformly random bits", [&] {
+		Float x;
+		do {
+			x = jkj::fp::detail::uniformly_randomly_generate_general_float<Float>(rg);
+		} while (!jkj::fp::ieee754_bits<Float>{ x }.is_finite());
+		return x;
+	});
+	// Either the larger or the smaller divisor succeeds, unpredictably.
+	run("mixed 3 digits and uniformly random", [&] {
+		return rg() % 2 == 0 ?
+			jkj::fp::detail::randomly_generate_float_with_given_digits<Float>(3, rg) :
+			jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+	});
+	for (unsigned int digits = 1; digits <= unsigned(std::numeric_limits<Float>::max_digits10) - 2;
+		++digits)
+	{
+		run(std::to_string(digits) + " digits", [&] {
+			return jkj::fp::detail::randomly_generate_float_with_given_digits<Float>(digits, rg);
+		});
+	}
+}
+
+int main() {
+	constexpr bool benchmark_float = true;
+	constexpr std::size_t number_of_samples_float = 100000;
+	constexpr int number_of_iterations_float = 20;
+
+	constexpr bool benchmark_double = true;
+	constexpr std::size_t number_of_samples_double = 100000;
+	constexpr int number_of_iterations_double = 20;
+
+	if constexpr (benchmark_float) {
+		std::cout << "[Running Dragonbox branch strategy benchmark for binary32...]\n";
+		benchmark_test<float>("binary32", number_of_samples_float, number_of_iterations_float);
+		std::cout << "Done.\n\n\n";
+	}
+	if constexpr (benchmark_double) {
+		std::cout << "[Running Dragonbox branch strategy benchmark for binary64...]\n";
+		benchmark_test<double>("binary64", number_of_samples_double, number_of_iterations_double);
+		std::cout << "Done.\n\n\n";
+	}
+}
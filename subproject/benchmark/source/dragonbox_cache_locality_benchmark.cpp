@@ -0,0 +1,149 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "random_float.h"
+#include "jkj/fp/dragonbox.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Measures the conversion when it is interleaved with other work that evicts the cache
+// entries from L1. The other work walks through a buffer larger than L1, touching
+// a given number of cache lines per conversion. The reported time includes the other work,
+// which is also measured alone. Run under perf stat -e L1-dcache-load-misses to see
+// the misses directly.
+
+// Numbers in [1e-9, 1e12) with random significands.
+template <class Float>
+static std::vector<Float> generate_samples(std::size_t number_of_samples)
+{
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_real_distribution<Float> significand_dist{ Float(1), Float(10) };
+	std::uniform_int_distribution<int> exponent_dist{ -9, 11 };
+	std::vector<Float> samples(number_of_samples);
+	for (auto& x : samples) {
+		x = significand_dist(rg) * std::pow(Float(10), Float(exponent_dist(rg)));
+	}
+	return samples;
+}
+
+class other_work {
+public:
+	static constexpr std::size_t cache_line_size = 64;
+	static constexpr std::size_t buffer_size = std::size_t(1) << 20;
+
+	explicit other_work(std::size_t lines_per_call) :
+		buffer_(buffer_size), lines_per_call_{ lines_per_call } {}
+
+	void operator()() noexcept {
+		for (std::size_t i = 0; i < lines_per_call_; ++i) {
+			buffer_[position_] += 1;
+			position_ = (position_ + cache_line_size) % buffer_size;
+		}
+	}
+
+	unsigned char checksum() const noexcept {
+		unsigned char result = 0;
+		for (auto c : buffer_) {
+			result ^= c;
+		}
+		return result;
+	}
+
+private:
+	std::vector<unsigned char> buffer_;
+	std::size_t lines_per_call_;
+	std::size_t position_ = 0;
+};
+
+template <class Float, class Func>
+static double measure(std::vector<Float> const& samples, other_work& work,
+	int number_of_iterations, Func&& func)
+{
+	std::uint64_t checksum = 0;
+	auto from = std::chrono::steady_clock::now();
+	for (int i = 0; i < number_of_iterations; ++i) {
+		for (auto const x : samples) {
+			checksum += func(x);
+			work();
+		}
+	}
+	auto dur = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - from);
+	if (checksum == 1) {
+		std::cout << work.checksum();
+	}
+	return dur.count() / double(number_of_iterations) / double(samples.size());
+}
+
+template <class Float>
+static void benchmark_test(std::string_view float_name, std::size_t number_of_samples,
+	int number_of_iterations)
+{
+	std::cout << "Generating random samples...\n";
+	auto const samples = generate_samples<Float>(number_of_samples);
+
+	auto filename = std::string("results/dragonbox_cache_locality_benchmark_");
+	filename += float_name;
+	filename += ".csv";
+	std::ofstream out_file{ filename };
+	out_file << "lines_per_conversion,name,ns\n";
+
+	namespace policy = jkj::fp::policy;
+	for (std::size_t lines : { 0, 4, 16, 64, 256 }) {
+		other_work work{ lines };
+		auto report = [&](char const* name, double ns) {
+			std::cout << lines << " lines per conversion, " << name << ": " << ns << " ns\n";
+			out_file << lines << "," << name << "," << ns << "\n";
+		};
+		auto report_policy = [&](char const* name, auto cache_policy) {
+			report(name, measure(samples, work, number_of_iterations, [&](Float x) {
+				auto const result = jkj::fp::to_shortest_decimal(x, cache_policy);
+				return std::uint64_t(result.significand) + std::uint64_t(result.exponent);
+			}));
+		};
+
+		report("other work only", measure(samples, work, number_of_iterations,
+			[](Float) { return std::uint64_t(0); }));
+		report_policy("fast", policy::cache::fast);
+		report_policy("compact", policy::cache::compact);
+		report_policy("hot_range<-9, 11>", policy::cache::hot_range<-9, 11>);
+	}
+}
+
+int main() {
+	constexpr bool benchmark_float = true;
+	constexpr std::size_t number_of_samples_float = 100000;
+	constexpr int number_of_iterations_float = 20;
+
+	constexpr bool benchmark_double = true;
+	constexpr std::size_t number_of_samples_double = 100000;
+	constexpr int number_of_iterations_double = 20;
+
+	if constexpr (benchmark_float) {
+		std::cout << "[Running Dragonbox cache locality benchmark for binary32...]\n";
+		benchmark_test<float>("binary32", number_of_samples_float, number_of_iterations_float);
+		std::cout << "Done.\n\n\n";
+	}
+	if constexpr (benchmark_double) {
+		std::cout << "[Running Dragonbox cache locality benchmark for binary64...]\n";
+		benchmark_test<double>("binary64", number_of_samples_double, number_of_iterations_double);
+		std::cout << "Done.\n\n\n";
+	}
+}
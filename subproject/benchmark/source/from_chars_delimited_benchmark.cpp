@@ -0,0 +1,107 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "random_float.h"
+#include "jkj/fp/from_chars/from_chars_delimited.h"
+#include "jkj/fp/to_chars/shortest_roundtrip.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Generates a CSV-like text of random numbers, number_of_columns numbers per line.
+template <class Float>
+static std::string generate_text(std::size_t number_of_lines, std::size_t number_of_columns)
+{
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	char buffer[64];
+
+	std::string text;
+	for (std::size_t line = 0; line < number_of_lines; ++line) {
+		for (std::size_t column = 0; column < number_of_columns; ++column) {
+			auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+			text.append(buffer, jkj::fp::to_chars_shortest_scientific_n(x, buffer));
+			text += column + 1 == number_of_columns ? '\n' : ',';
+		}
+	}
+	return text;
+}
+
+template <class Float>
+static void benchmark_test(std::string_view float_name, std::size_t number_of_lines,
+	std::size_t number_of_columns, int number_of_iterations)
+{
+	std::cout << "Generating random samples...\n";
+	auto const text = generate_text<Float>(number_of_lines, number_of_columns);
+	std::vector<Float> column(number_of_lines * number_of_columns);
+
+	auto const max_number_of_threads = jkj::fp::detail::default_number_of_threads();
+
+	auto filename = std::string("results/from_chars_delimited_benchmark_");
+	filename += float_name;
+	filename += ".csv";
+	std::ofstream out_file{ filename };
+	out_file << "bytes," << text.size() << std::endl;
+	out_file << "threads,GB/s\n";
+
+	for (unsigned int number_of_threads = 1; number_of_threads <= max_number_of_threads;
+		number_of_threads *= 2)
+	{
+		// Threads are started once and reused across the iterations.
+		jkj::fp::from_chars_thread_pool pool{ number_of_threads };
+		auto from = std::chrono::steady_clock::now();
+		for (int i = 0; i < number_of_iterations; ++i) {
+			auto const count = jkj::fp::from_chars_delimited<Float>(text.data(),
+				text.data() + text.size(), ",\n", column.data(), column.size(), pool);
+			if (count != column.size()) {
+				std::cout << "Error: parsed " << count << " numbers.\n";
+			}
+		}
+		auto dur = std::chrono::duration<double>(std::chrono::steady_clock::now() - from);
+		auto const gb_per_sec = double(text.size()) * number_of_iterations / dur.count() / 1e9;
+
+		std::cout << number_of_threads << " thread(s): " << gb_per_sec << " GB/s\n";
+		out_file << number_of_threads << "," << gb_per_sec << "\n";
+	}
+}
+
+int main() {
+	constexpr bool benchmark_float = true;
+	constexpr std::size_t number_of_lines_float = 1000000;
+	constexpr std::size_t number_of_columns_float = 16;
+	constexpr int number_of_iterations_float = 5;
+
+	constexpr bool benchmark_double = true;
+	constexpr std::size_t number_of_lines_double = 1000000;
+	constexpr std::size_t number_of_columns_double = 16;
+	constexpr int number_of_iterations_double = 5;
+
+	if constexpr (benchmark_float) {
+		std::cout << "[Running delimited parsing benchmark for binary32...]\n";
+		benchmark_test<float>("binary32", number_of_lines_float,
+			number_of_columns_float, number_of_iterations_float);
+		std::cout << "Done.\n\n\n";
+	}
+	if constexpr (benchmark_double) {
+		std::cout << "[Running delimited parsing benchmark for binary64...]\n";
+		benchmark_test<double>("binary64", number_of_lines_double,
+			number_of_columns_double, number_of_iterations_double);
+		std::cout << "Done.\n\n\n";
+	}
+}
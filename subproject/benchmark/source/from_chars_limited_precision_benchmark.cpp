@@ -30,6 +30,24 @@
 #include <unordered_map>
 #include <vector>
 
+// Prints a random number of the given number of digits with at most 4 digits after
+// the decimal dot, which is typical for prices.
+static std::string print_price_like(unsigned int digits, std::mt19937_64& rg)
+{
+	std::string str;
+	str += char('1' + std::uniform_int_distribution<int>{ 0, 8 }(rg));
+	for (unsigned int i = 1; i < digits; ++i) {
+		str += char('0' + std::uniform_int_distribution<int>{ 0, 9 }(rg));
+	}
+
+	auto const fractional_digits = std::uniform_int_distribution<unsigned int>{
+		0, digits - 1 < 4 ? digits - 1 : 4 }(rg);
+	if (fractional_digits != 0) {
+		str.insert(str.end() - fractional_digits, '.');
+	}
+	return str;
+}
+
 template <class Float>
 class benchmark_holder
 {
@@ -43,16 +61,21 @@ public:
 	}
 
 	// Generate random samples
-	void prepare_samples(std::size_t number_of_samples_per_digits)
+	void prepare_samples(std::size_t number_of_samples_per_digits, bool price_like)
 	{
 		auto buffer = std::make_unique<char[]>(10000);
 
 		for (unsigned int digits = 1; digits <= max_digits; ++digits) {
 			samples_[digits - 1].resize(number_of_samples_per_digits);
 			for (auto& sample : samples_[digits - 1]) {
-				auto x = jkj::fp::detail::uniformly_randomly_generate_general_float<Float>(rg_);
-				sample.assign(buffer.get(),
-					jkj::fp::to_chars_fixed_precision_scientific_n(x, buffer.get(), digits - 1));
+				if (price_like) {
+					sample = print_price_like(digits, rg_);
+				}
+				else {
+					auto x = jkj::fp::detail::uniformly_randomly_generate_general_float<Float>(rg_);
+					sample.assign(buffer.get(),
+						jkj::fp::to_chars_fixed_precision_scientific_n(x, buffer.get(), digits - 1));
+				}
 			}
 		}
 	}
@@ -145,24 +168,29 @@ register_function_for_from_chars_limited_precision_benchmark::register_function_
 void run_matlab() {
 	std::system("matlab -nosplash -r \"cd('matlab');addpath('../../3rdparty/shaded_plots');"
 		"plot_digit_benchmark(\'../results/from_chars_limited_precision_benchmark_binary32.csv\');"
-		"plot_digit_benchmark(\'../results/from_chars_limited_precision_benchmark_binary64.csv\');\"");
+		"plot_digit_benchmark(\'../results/from_chars_limited_precision_benchmark_binary64.csv\');"
+		"plot_digit_benchmark(\'../results/from_chars_limited_precision_benchmark_price_like_binary32.csv\');"
+		"plot_digit_benchmark(\'../results/from_chars_limited_precision_benchmark_price_like_binary64.csv\');\"");
 }
 #endif
 
 template <class Float>
 void benchmark_test(std::string_view float_name,
 	std::size_t number_of_samples_per_digits,
-	std::size_t number_of_iterations)
+	std::size_t number_of_iterations, bool price_like)
 {
 	auto& inst = benchmark_holder<Float>::get_instance();
 	std::cout << "Generating random samples...\n";
-	inst.prepare_samples(number_of_samples_per_digits);
+	inst.prepare_samples(number_of_samples_per_digits, price_like);
 	auto out = inst.run(number_of_iterations, float_name);
 
 	std::cout << "Benchmarking done.\n" << "Now writing to files...\n";
 
 	// Write benchmark results
 	auto filename = std::string("results/from_chars_limited_precision_benchmark_");
+	if (price_like) {
+		filename += "price_like_";
+	}
 	filename += float_name;
 	filename += ".csv";
 	std::ofstream out_file{ filename };
@@ -194,14 +222,26 @@ int main() {
 		std::cout << "[Running limited-precision parsing benchmark for binary32...]\n";
 		benchmark_test<float>("binary32",
 			number_of_samples_per_digits_float,
-			number_of_benchmark_iterations_float);
+			number_of_benchmark_iterations_float, false);
+		std::cout << "Done.\n\n\n";
+
+		std::cout << "[Running limited-precision parsing benchmark for binary32 with price-like inputs...]\n";
+		benchmark_test<float>("binary32",
+			number_of_samples_per_digits_float,
+			number_of_benchmark_iterations_float, true);
 		std::cout << "Done.\n\n\n";
 	}
 	if constexpr (benchmark_double) {
 		std::cout << "[Running limited-precision parsing  benchmark for binary64...]\n";
 		benchmark_test<double>("binary64",
 			number_of_samples_per_digits_double,
-			number_of_benchmark_iterations_double);
+			number_of_benchmark_iterations_double, false);
+		std::cout << "Done.\n\n\n";
+
+		std::cout << "[Running limited-precision parsing benchmark for binary64 with price-like inputs...]\n";
+		benchmark_test<double>("binary64",
+			number_of_samples_per_digits_double,
+			number_of_benchmark_iterations_double, true);
 		std::cout << "Done.\n\n\n";
 	}
 
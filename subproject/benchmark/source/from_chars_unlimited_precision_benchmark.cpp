@@ -18,7 +18,10 @@
 #include "from_chars_unlimited_precision_benchmark.h"
 #include "random_float.h"
 #include "jkj/fp/to_chars/fixed_precision.h"
+#include "jkj/fp/ryu_printf.h"
 #include <chrono>
+#include <cmath>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <iomanip>
@@ -29,6 +32,39 @@
 #include <unordered_map>
 #include <vector>
 
+// Prints the middle point between x and its successor with precision + 1 significant digits,
+// truncating the remaining digits. These inputs cannot be decided from the first few digits.
+template <class Float>
+std::string print_near_halfway(Float x, int precision)
+{
+	using jkj::fp::ryu_printf;
+	ryu_printf<Float> digit_gen{ jkj::fp::ieee754_bits<Float>{ x }, std::bool_constant<true>{} };
+
+	std::string digits;
+	char segment[ryu_printf<Float>::segment_size + 1];
+	int last_segment_index;
+	do {
+		std::snprintf(segment, sizeof(segment), "%09u", unsigned(digit_gen.current_segment()));
+		digits += segment;
+		last_segment_index = digit_gen.current_segment_index();
+	} while (int(digits.size()) <= precision + 2 * ryu_printf<Float>::segment_size &&
+		digit_gen.compute_next_segment());
+	int exponent = -last_segment_index * ryu_printf<Float>::segment_size;
+
+	auto const first_nonzero = digits.find_first_not_of('0');
+	digits.erase(0, first_nonzero);
+	if (int(digits.size()) > precision + 1) {
+		exponent += int(digits.size()) - (precision + 1);
+		digits.resize(std::size_t(precision + 1));
+	}
+
+	std::string result = std::signbit(x) ? "-" : "";
+	result += digits;
+	result += 'e';
+	result += std::to_string(exponent);
+	return result;
+}
+
 template <class Float>
 class benchmark_holder
 {
@@ -39,7 +75,7 @@ public:
 	}
 
 	// Generate random samples
-	void prepare_samples(std::size_t number_of_samples, int max_precision)
+	void prepare_samples(std::size_t number_of_samples, int max_precision, bool near_halfway)
 	{
 		assert(max_precision >= 0);
 		auto buffer = std::make_unique<char[]>(10000);
@@ -48,8 +84,13 @@ public:
 			samples_[precision].resize(number_of_samples);
 			for (auto& sample : samples_[precision]) {
 				auto x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg_);
-				sample.assign(buffer.get(),
-					jkj::fp::to_chars_fixed_precision_scientific_n(x, buffer.get(), precision));
+				if (near_halfway) {
+					sample = print_near_halfway(x, precision);
+				}
+				else {
+					sample.assign(buffer.get(),
+						jkj::fp::to_chars_fixed_precision_scientific_n(x, buffer.get(), precision));
+				}
 			}
 		}
 	}
@@ -145,23 +186,28 @@ register_function_for_from_chars_unlimited_precision_benchmark::register_functio
 void run_matlab() {
 	std::system("matlab -nosplash -r \"cd('matlab');"
 		"plot_fixed_precision_benchmark(\'../results/from_chars_unlimited_precision_benchmark_binary32.csv\');"
-		"plot_fixed_precision_benchmark(\'../results/from_chars_unlimited_precision_benchmark_binary64.csv\');\"");
+		"plot_fixed_precision_benchmark(\'../results/from_chars_unlimited_precision_benchmark_binary64.csv\');"
+		"plot_fixed_precision_benchmark(\'../results/from_chars_unlimited_precision_benchmark_near_halfway_binary32.csv\');"
+		"plot_fixed_precision_benchmark(\'../results/from_chars_unlimited_precision_benchmark_near_halfway_binary64.csv\');\"");
 }
 #endif
 
 template <class Float>
 static void benchmark_test(std::string_view float_name, std::size_t number_of_samples,
-	double duration_per_each_precision_in_sec, int max_precision)
+	double duration_per_each_precision_in_sec, int max_precision, bool near_halfway)
 {
 	auto& inst = benchmark_holder<Float>::get_instance();
 	std::cout << "Generating random samples...\n";
-	inst.prepare_samples(number_of_samples, max_precision);
+	inst.prepare_samples(number_of_samples, max_precision, near_halfway);
 	auto out = inst.run(duration_per_each_precision_in_sec, float_name);
 
 	std::cout << "Benchmarking done.\n" << "Now writing to files...\n";
 
 	// Write benchmark results
 	auto filename = std::string("results/from_chars_unlimited_precision_benchmark_");
+	if (near_halfway) {
+		filename += "near_halfway_";
+	}
 	filename += float_name;
 	filename += ".csv";
 	std::ofstream out_file{ filename };
@@ -192,7 +238,14 @@ int main() {
 		benchmark_test<float>("binary32",
 			number_of_benchmark_samples_float,
 			duration_per_each_precision_in_sec_float,
-			max_precision_float);
+			max_precision_float, false);
+		std::cout << "Done.\n\n\n";
+
+		std::cout << "[Running unlimited-precision parsing benchmark for near-halfway binary32...]\n";
+		benchmark_test<float>("binary32",
+			number_of_benchmark_samples_float,
+			duration_per_each_precision_in_sec_float,
+			max_precision_float, true);
 		std::cout << "Done.\n\n\n";
 	}
 	if constexpr (benchmark_double) {
@@ -200,7 +253,14 @@ int main() {
 		benchmark_test<double>("binary64",
 			number_of_benchmark_samples_double,
 			duration_per_each_precision_in_sec_double,
-			max_precision_double);
+			max_precision_double, false);
+		std::cout << "Done.\n\n\n";
+
+		std::cout << "[Running unlimited-precision parsing benchmark for near-halfway binary64...]\n";
+		benchmark_test<double>("binary64",
+			number_of_benchmark_samples_double,
+			duration_per_each_precision_in_sec_double,
+			max_precision_double, true);
 		std::cout << "Done.\n\n\n";
 	}
 
@@ -0,0 +1,125 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "random_float.h"
+#include "jkj/fp/scaled_decimal.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Prices and the like: random numbers in [-10^6, 10^6) with many fractional digits.
+template <class Float>
+static std::vector<Float> generate_samples(std::size_t number_of_samples)
+{
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_real_distribution<Float> dist{ Float(-1e6), Float(1e6) };
+	std::vector<Float> samples(number_of_samples);
+	for (auto& x : samples) {
+		x = dist(rg);
+	}
+	return samples;
+}
+
+template <class Float, class Func>
+static double measure(std::vector<Float> const& samples, std::vector<Float>& results,
+	int number_of_iterations, Func&& func)
+{
+	auto from = std::chrono::steady_clock::now();
+	for (int i = 0; i < number_of_iterations; ++i) {
+		func(samples, results);
+	}
+	auto dur = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - from);
+	return dur.count() / double(number_of_iterations) / double(samples.size());
+}
+
+template <class Float>
+static void benchmark_test(std::string_view float_name, std::size_t number_of_samples,
+	int number_of_iterations)
+{
+	std::cout << "Generating random samples...\n";
+	auto const samples = generate_samples<Float>(number_of_samples);
+	std::vector<Float> results(number_of_samples);
+
+	auto filename = std::string("results/round_to_decimal_places_benchmark_");
+	filename += float_name;
+	filename += ".csv";
+	std::ofstream out_file{ filename };
+	out_file << "decimal_places,name,ns\n";
+
+	for (int decimal_places = 0; decimal_places <= 8; decimal_places += 2) {
+		auto const scale = std::pow(Float(10), Float(decimal_places));
+
+		auto report = [&](char const* name, double ns) {
+			std::cout << decimal_places << " decimal places, " << name << ": " << ns << " ns\n";
+			out_file << decimal_places << "," << name << "," << ns << "\n";
+		};
+
+		report("snprintf + strtod", measure(samples, results, number_of_iterations,
+			[&](auto const& in, auto& out) {
+				char buffer[64];
+				for (std::size_t i = 0; i < in.size(); ++i) {
+					std::snprintf(buffer, sizeof(buffer), "%.*f", decimal_places, double(in[i]));
+					out[i] = Float(std::strtod(buffer, nullptr));
+				}
+			}));
+		// Not correctly rounded; for reference only.
+		report("round(x * 10^n) / 10^n", measure(samples, results, number_of_iterations,
+			[&](auto const& in, auto& out) {
+				for (std::size_t i = 0; i < in.size(); ++i) {
+					out[i] = std::round(in[i] * scale) / scale;
+				}
+			}));
+		report("round_to_decimal_places", measure(samples, results, number_of_iterations,
+			[&](auto const& in, auto& out) {
+				for (std::size_t i = 0; i < in.size(); ++i) {
+					out[i] = jkj::fp::round_to_decimal_places(in[i], decimal_places);
+				}
+			}));
+		report("round_to_decimal_places_batch", measure(samples, results, number_of_iterations,
+			[&](auto const& in, auto& out) {
+				jkj::fp::round_to_decimal_places_batch(in.data(), in.data() + in.size(),
+					decimal_places, out.data());
+			}));
+	}
+}
+
+int main() {
+	constexpr bool benchmark_float = true;
+	constexpr std::size_t number_of_samples_float = 1000000;
+	constexpr int number_of_iterations_float = 10;
+
+	constexpr bool benchmark_double = true;
+	constexpr std::size_t number_of_samples_double = 1000000;
+	constexpr int number_of_iterations_double = 10;
+
+	if constexpr (benchmark_float) {
+		std::cout << "[Running round_to_decimal_places benchmark for binary32...]\n";
+		benchmark_test<float>("binary32", number_of_samples_float, number_of_iterations_float);
+		std::cout << "Done.\n\n\n";
+	}
+	if constexpr (benchmark_double) {
+		std::cout << "[Running round_to_decimal_places benchmark for binary64...]\n";
+		benchmark_test<double>("binary64", number_of_samples_double, number_of_iterations_double);
+		std::cout << "Done.\n\n\n";
+	}
+}
@@ -0,0 +1,181 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/dragonbox.h"
+#include "random_float.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+// Records the range of k requested by Dragonbox.
+struct recording_cache {
+	using policy_kind = jkj::fp::policy_kind::cache;
+	using cache_policy = recording_cache;
+	static constexpr bool has_shorter_interval_table = false;
+
+	static inline int min_k = 0;
+	static inline int max_k = -1;
+
+	template <jkj::fp::ieee754_format format>
+	static typename jkj::fp::detail::dragonbox::cache_holder<format>::cache_entry_type
+		get_cache(int k) noexcept
+	{
+		if (min_k > max_k) {
+			min_k = k;
+			max_k = k;
+		}
+		else {
+			min_k = k < min_k ? k : min_k;
+			max_k = k > max_k ? k : max_k;
+		}
+		return jkj::fp::detail::policy::cache::fast::get_cache<format>(k);
+	}
+};
+
+template <class CacheEntry>
+void write_entry(std::ostream& out, CacheEntry const& entry) {
+	if constexpr (std::is_same_v<CacheEntry, std::uint64_t>) {
+		out << "0x" << std::setw(16) << entry;
+	}
+	else {
+		out << "{ 0x" << std::setw(16) << entry.high() << ", 0x" << std::setw(16) << entry.low() << " }";
+	}
+}
+
+// Measures the range of k used for the numbers with decimal exponents in
+// [min_decimal_exponent, max_decimal_exponent], compares it with the range
+// hot_range_cache_detail computes, and writes out the table.
+template <class Float, int min_decimal_exponent, int max_decimal_exponent>
+void generate_table_impl(std::ostream& out, std::size_t number_of_samples_per_exponent)
+{
+	using namespace jkj::fp::detail;
+	using ieee754_traits = jkj::fp::ieee754_traits<Float>;
+	using ieee754_format_info = jkj::fp::ieee754_format_info<ieee754_traits::format>;
+	using carrier_uint = typename ieee754_traits::carrier_uint;
+	using hot_range_cache = dragonbox::hot_range_cache_detail<ieee754_traits::format,
+		dragonbox::impl_base<ieee754_traits::format>::kappa,
+		min_decimal_exponent, max_decimal_exponent>;
+	constexpr auto significand_bits = ieee754_format_info::significand_bits;
+
+	namespace policy = jkj::fp::policy;
+	auto rg = generate_correctly_seeded_mt19937_64();
+	recording_cache::min_k = 0;
+	recording_cache::max_k = -1;
+
+	auto convert = [](Float x) {
+		jkj::fp::to_shortest_decimal(x, recording_cache{});
+		jkj::fp::to_shortest_decimal(x, recording_cache{},
+			policy::binary_rounding::toward_plus_infinity);
+		jkj::fp::to_shortest_decimal(x, recording_cache{},
+			policy::binary_rounding::toward_minus_infinity);
+		// A tolerance of at least half an ulp and less than x, unless x is the smallest.
+		jkj::fp::to_shortest_decimal_within(x,
+			std::max(x / 4, std::numeric_limits<Float>::denorm_min()), recording_cache{});
+	};
+
+	constexpr unsigned int max_exponent_bits = (1u << ieee754_format_info::exponent_bits) - 2;
+	for (unsigned int exponent_bits = 0; exponent_bits <= max_exponent_bits; ++exponent_bits) {
+		for (std::size_t i = 0; i < number_of_samples_per_exponent + 2; ++i) {
+			// The smallest and the largest significands, and random ones.
+			auto significand = carrier_uint(rg()) & ((carrier_uint(1) << significand_bits) - 1);
+			if (i == 0) {
+				significand = exponent_bits == 0 ? 1 : 0;
+			}
+			else if (i == 1) {
+				significand = (carrier_uint(1) << significand_bits) - 1;
+			}
+			auto const x = jkj::fp::ieee754_bits<Float>{ carrier_uint(
+				(carrier_uint(exponent_bits) << significand_bits) | significand) }.to_float();
+			if (x == 0) {
+				continue;
+			}
+
+			auto const decimal_exponent = int(std::floor(std::log10((long double)(x))));
+			if (decimal_exponent >= min_decimal_exponent &&
+				decimal_exponent <= max_decimal_exponent)
+			{
+				convert(x);
+			}
+		}
+	}
+
+	if (recording_cache::min_k < hot_range_cache::min_k ||
+		recording_cache::max_k > hot_range_cache::max_k)
+	{
+		throw std::logic_error{ "k = [" + std::to_string(recording_cache::min_k) + ", " +
+			std::to_string(recording_cache::max_k) + "] is used, but the table covers [" +
+			std::to_string(hot_range_cache::min_k) + ", " +
+			std::to_string(hot_range_cache::max_k) + "]" };
+	}
+	std::cout << "k = [" << recording_cache::min_k << ", " << recording_cache::max_k
+		<< "] is used; the table covers [" << hot_range_cache::min_k << ", "
+		<< hot_range_cache::max_k << "] (" << sizeof(hot_range_cache::cache) << " bytes).\n";
+
+	out << "static constexpr int min_k = " << hot_range_cache::min_k << ";\n";
+	out << "static constexpr int max_k = " << hot_range_cache::max_k << ";\n\n";
+	out << "alignas(64) static constexpr cache_entry_type cache[] = {\n\t";
+	out << std::hex << std::setfill('0');
+	for (std::size_t i = 0; i < hot_range_cache::table_size; ++i) {
+		write_entry(out, hot_range_cache::cache.table[i]);
+		if (i != hot_range_cache::table_size - 1) {
+			out << ",\n\t";
+		}
+	}
+	out << std::dec << "\n};";
+}
+
+int main()
+{
+	// The decimal exponent range of the table to generate.
+	constexpr int min_decimal_exponent = -9;
+	constexpr int max_decimal_exponent = 12;
+	constexpr std::size_t number_of_samples_per_exponent = 1000;
+
+	std::ofstream out;
+	bool success = true;
+	std::cout << "[Generating hot range cache for Dragonbox...]\n";
+
+	try {
+		std::cout << "\nGenerating hot range cache for IEEE-754 binary32 format...\n";
+		out.open("results/dragonbox_binary32_hot_range_cache.txt");
+		generate_table_impl<float, min_decimal_exponent, max_decimal_exponent>(out,
+			number_of_samples_per_exponent);
+		out.close();
+
+		std::cout << "\nGenerating hot range cache for IEEE-754 binary64 format...\n";
+		out.open("results/dragonbox_binary64_hot_range_cache.txt");
+		generate_table_impl<double, min_decimal_exponent, max_decimal_exponent>(out,
+			number_of_samples_per_exponent);
+		out.close();
+	}
+	catch (std::exception& ex) {
+		std::cout << ex.what() << std::endl;
+		success = false;
+	}
+
+	std::cout << std::endl;
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
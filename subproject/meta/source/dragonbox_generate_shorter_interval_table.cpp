@@ -0,0 +1,145 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/dragonbox.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+// Each entry is the significand of the shortest representation of 2^e without trailing zeros,
+// with the decimal exponent minus k stored in the upper bits. The entry is zero for the
+// exponents where the result depends on the interval type or the decimal rounding policy.
+template <class Float>
+struct generated_table {
+	using carrier_uint = typename jkj::fp::ieee754_traits<Float>::carrier_uint;
+
+	int exponent_offset_shift;
+	std::vector<carrier_uint> table;
+};
+
+template <class GeneratedTable>
+void write_to(std::ostream& out, GeneratedTable const& results) {
+	out << std::dec;
+	out << "static constexpr int exponent_offset_shift = "
+		<< results.exponent_offset_shift << ";\n\n";
+	out << "static constexpr entry_type table[] = {\n\t";
+	for (std::size_t i = 0; i < results.table.size(); ++i) {
+		out << "0x" << std::hex << std::setfill('0')
+			<< std::setw(sizeof(results.table[i]) * 2) << results.table[i];
+		if (i != results.table.size() - 1) {
+			out << (i % 4 == 3 ? ",\n\t" : ", ");
+		}
+	}
+	out << std::dec << "\n};";
+}
+
+template <class Float>
+auto generate_table_impl(int exponent_offset_shift)
+{
+	using namespace jkj::fp::detail;
+	using ieee754_traits = jkj::fp::ieee754_traits<Float>;
+	using ieee754_format_info = jkj::fp::ieee754_format_info<ieee754_traits::format>;
+	using carrier_uint = typename ieee754_traits::carrier_uint;
+	using impl = dragonbox::impl<Float>;
+	constexpr auto significand_bits = ieee754_format_info::significand_bits;
+
+	auto is_special = [](int exponent) {
+		return (exponent >= impl::case_shorter_interval_left_endpoint_lower_threshold &&
+			exponent <= impl::case_shorter_interval_left_endpoint_upper_threshold) ||
+			(exponent >= impl::case_shorter_interval_right_endpoint_lower_threshold &&
+				exponent <= impl::case_shorter_interval_right_endpoint_upper_threshold) ||
+			(exponent >= impl::shorter_interval_tie_lower_threshold &&
+				exponent <= impl::shorter_interval_tie_upper_threshold);
+	};
+
+	generated_table<Float> results;
+	results.exponent_offset_shift = exponent_offset_shift;
+
+	constexpr unsigned int max_exponent_bits = (1u << ieee754_format_info::exponent_bits) - 2;
+	for (unsigned int exponent_bits = 1; exponent_bits <= max_exponent_bits; ++exponent_bits) {
+		int const exponent = int(exponent_bits) + ieee754_format_info::exponent_bias - significand_bits;
+		if (is_special(exponent)) {
+			results.table.push_back(0);
+			continue;
+		}
+
+		auto const x = jkj::fp::ieee754_bits<Float>{
+			carrier_uint(carrier_uint(exponent_bits) << significand_bits) }.to_float();
+
+		namespace policy = jkj::fp::policy;
+		auto const result = jkj::fp::to_shortest_decimal(x, policy::sign::ignore,
+			policy::cache::fast);
+
+		// The result should not depend on the policies for the other exponents.
+		auto check = [&](auto const& other) {
+			if (other.significand != result.significand || other.exponent != result.exponent) {
+				throw std::logic_error{ "the result depends on the policies" };
+			}
+		};
+		check(jkj::fp::to_shortest_decimal(x, policy::sign::ignore,
+			policy::binary_rounding::nearest_to_odd, policy::decimal_rounding::to_odd));
+		check(jkj::fp::to_shortest_decimal(x, policy::sign::ignore,
+			policy::binary_rounding::nearest_toward_zero, policy::decimal_rounding::toward_zero));
+		check(jkj::fp::to_shortest_decimal(x, policy::sign::ignore,
+			policy::binary_rounding::nearest_away_from_zero,
+			policy::decimal_rounding::away_from_zero));
+
+		int const minus_k = log::floor_log10_pow2_minus_log10_4_over_3(exponent);
+		int const offset = result.exponent - minus_k;
+		if (result.significand == 0 || result.significand >= (carrier_uint(1) << exponent_offset_shift) ||
+			offset < 0 || offset >= (1 << (ieee754_traits::carrier_bits - exponent_offset_shift)))
+		{
+			throw std::logic_error{ "the result does not fit in an entry" };
+		}
+		results.table.push_back(
+			carrier_uint(result.significand | (carrier_uint(offset) << exponent_offset_shift)));
+	}
+
+	return results;
+}
+
+int main()
+{
+	std::ofstream out;
+	bool success = true;
+	std::cout << "[Generating shorter interval table for Dragonbox...]\n";
+
+	try {
+		std::cout << "\nGenerating shorter interval table for IEEE-754 binary32 format...\n";
+		out.open("results/dragonbox_binary32_shorter_interval_table.txt");
+		write_to(out, generate_table_impl<float>(27));
+		out.close();
+
+		std::cout << "\nGenerating shorter interval table for IEEE-754 binary64 format...\n";
+		out.open("results/dragonbox_binary64_shorter_interval_table.txt");
+		write_to(out, generate_table_impl<double>(59));
+		out.close();
+	}
+	catch (std::exception& ex) {
+		std::cout << ex.what() << std::endl;
+		success = false;
+	}
+
+	std::cout << std::endl;
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
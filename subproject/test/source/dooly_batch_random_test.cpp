@@ -0,0 +1,217 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/dooly.h"
+#include "jkj/fp/dragonbox.h"
+#include "random_float.h"
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using carrier_uint = typename jkj::fp::ieee754_traits<Float>::carrier_uint;
+	using decimal_fp = jkj::fp::unsigned_decimal_fp<Float>;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<std::size_t> length_dist{ 0, 300 };
+	std::uniform_int_distribution<int> digits_dist{ 0,
+		std::numeric_limits<carrier_uint>::digits10 };
+	std::uniform_int_distribution<int> exponent_dist{ -400, 400 };
+
+	// Random inputs, including shortest representations which are often
+	// exactly on a boundary after dropping their last digit.
+	auto generate = [&]() {
+		decimal_fp decimal;
+		switch (rg() % 3) {
+		case 0:
+		{
+			auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+			auto const shortest = jkj::fp::to_shortest_decimal(x, jkj::fp::policy::sign::ignore);
+			decimal.significand = shortest.significand;
+			decimal.exponent = shortest.exponent;
+			break;
+		}
+		case 1:
+		{
+			// Random number of digits, so that small integers appear often.
+			auto const digits = digits_dist(rg);
+			carrier_uint significand = 0;
+			for (int i = 0; i < digits; ++i) {
+				significand = significand * 10 + carrier_uint(rg() % 10);
+			}
+			decimal.significand = significand;
+			decimal.exponent = std::uniform_int_distribution<int>{ -30, 30 }(rg);
+			break;
+		}
+		default:
+			decimal.significand = carrier_uint(rg());
+			decimal.exponent = exponent_dist(rg);
+		}
+		return decimal;
+	};
+
+	bool success = true;
+	std::vector<decimal_fp> inputs;
+	std::vector<Float> outputs;
+
+	auto check = [&](char const* policy_name, auto... policies) {
+		outputs.assign(inputs.size(), Float(0));
+		auto const end = jkj::fp::to_binary_limited_precision_batch(
+			inputs.data(), inputs.data() + inputs.size(), outputs.data(), policies...);
+		if (end != outputs.data() + outputs.size()) {
+			std::cout << "Error detected! [policy = " << policy_name << ", wrong end position]\n";
+			success = false;
+		}
+		for (std::size_t i = 0; i < inputs.size(); ++i) {
+			auto const expected = jkj::fp::to_binary_limited_precision(inputs[i], policies...);
+			auto const computed = jkj::fp::ieee754_bits<Float>{ outputs[i] };
+			if (expected.u != computed.u) {
+				std::cout << "Error detected! [policy = " << policy_name
+					<< ", input = " << inputs[i].significand << "e" << inputs[i].exponent
+					<< ", expected = " << expected.u << ", computed = " << computed.u << "]\n";
+				success = false;
+			}
+		}
+	};
+
+	std::size_t count = 0;
+	while (count < number_of_samples) {
+		inputs.resize(length_dist(rg));
+		for (auto& input : inputs) {
+			input = generate();
+		}
+		count += inputs.size();
+
+		namespace br = jkj::fp::policy::binary_rounding;
+		check("nearest_to_even");
+		check("nearest_to_odd", br::nearest_to_odd);
+		check("nearest_toward_zero", br::nearest_toward_zero);
+		check("nearest_away_from_zero", br::nearest_away_from_zero);
+		check("toward_plus_infinity", br::toward_plus_infinity);
+		check("toward_minus_infinity", br::toward_minus_infinity);
+		check("cache::compact", jkj::fp::policy::cache::compact);
+	}
+
+	if (success) {
+		std::cout << "Batch conversion random test for " << type_name_string
+			<< " with " << count << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+template <class Float, class TypenameString>
+static bool test_fixed_exponent(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using carrier_uint = typename jkj::fp::ieee754_traits<Float>::carrier_uint;
+	using signed_int = std::make_signed_t<carrier_uint>;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<std::size_t> length_dist{ 0, 300 };
+	std::uniform_int_distribution<int> exponent_dist{ -30, 30 };
+	std::uniform_int_distribution<signed_int> small_dist{ -100000, 100000 };
+
+	bool success = true;
+	std::vector<signed_int> inputs;
+	std::vector<Float> outputs;
+	int exponent = 0;
+
+	auto check = [&](char const* policy_name, auto... policies) {
+		outputs.assign(inputs.size(), Float(0));
+		auto const end = jkj::fp::to_binary_limited_precision_batch(
+			inputs.data(), inputs.data() + inputs.size(), exponent, outputs.data(), policies...);
+		if (end != outputs.data() + outputs.size()) {
+			std::cout << "Error detected! [policy = " << policy_name << ", wrong end position]\n";
+			success = false;
+		}
+		for (std::size_t i = 0; i < inputs.size(); ++i) {
+			jkj::fp::signed_decimal_fp<Float> decimal;
+			decimal.is_negative = inputs[i] < 0;
+			decimal.significand = decimal.is_negative ?
+				carrier_uint(carrier_uint(0) - carrier_uint(inputs[i])) : carrier_uint(inputs[i]);
+			decimal.exponent = exponent;
+
+			auto const expected = jkj::fp::to_binary_limited_precision(decimal, policies...);
+			auto const computed = jkj::fp::ieee754_bits<Float>{ outputs[i] };
+			if (expected.u != computed.u) {
+				std::cout << "Error detected! [policy = " << policy_name
+					<< ", input = " << inputs[i] << "e" << exponent
+					<< ", expected = " << expected.u << ", computed = " << computed.u << "]\n";
+				success = false;
+			}
+		}
+	};
+
+	std::size_t count = 0;
+	while (count < number_of_samples) {
+		inputs.resize(length_dist(rg));
+		for (auto& input : inputs) {
+			switch (rg() % 4) {
+			case 0:
+				input = std::numeric_limits<signed_int>::min();
+				break;
+			case 1:
+				input = signed_int(rg());
+				break;
+			default:
+				input = small_dist(rg);
+			}
+		}
+		exponent = rg() % 8 == 0 ? std::uniform_int_distribution<int>{ -400, 400 }(rg) :
+			exponent_dist(rg);
+		count += inputs.size();
+
+		namespace br = jkj::fp::policy::binary_rounding;
+		check("nearest_to_even");
+		check("nearest_toward_plus_infinity", br::nearest_toward_plus_infinity);
+		check("toward_plus_infinity", br::toward_plus_infinity);
+		check("toward_minus_infinity", br::toward_minus_infinity);
+		check("toward_zero", br::toward_zero);
+		check("away_from_zero", br::away_from_zero);
+		check("sign::ignore, toward_minus_infinity", jkj::fp::policy::sign::ignore,
+			br::toward_minus_infinity);
+		check("cache::compact", jkj::fp::policy::cache::compact);
+	}
+
+	if (success) {
+		std::cout << "Fixed-exponent batch conversion random test for " << type_name_string
+			<< " with " << count << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 1000000;
+
+	bool success = true;
+
+	std::cout << "[Testing Dooly batch conversion...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	success &= test_fixed_exponent<float>(number_of_samples, "binary32");
+	success &= test_fixed_exponent<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
@@ -0,0 +1,163 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/dooly.h"
+#include "jkj/fp/from_chars/from_chars.h"
+#include "random_float.h"
+#include <cfenv>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+template <class Float>
+static jkj::fp::ieee754_bits<Float> strtof_with_rounding(std::string const& str, int mode)
+{
+	std::fesetround(mode);
+	Float result;
+	if constexpr (std::is_same_v<Float, float>) {
+		result = std::strtof(str.c_str(), nullptr);
+	}
+	else {
+		result = std::strtod(str.c_str(), nullptr);
+	}
+	std::fesetround(FE_TONEAREST);
+	return jkj::fp::ieee754_bits<Float>{ result };
+}
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, int min_exponent, int max_exponent,
+	TypenameString&& type_name_string)
+{
+	using carrier_uint = typename jkj::fp::ieee754_traits<Float>::carrier_uint;
+	constexpr auto digit_limit =
+		jkj::fp::to_binary_limited_precision_digit_limit<jkj::fp::ieee754_traits<Float>::format>;
+	constexpr auto carrier_bits = jkj::fp::ieee754_traits<Float>::carrier_bits;
+	constexpr auto significand_bits = jkj::fp::ieee754_format_info<jkj::fp::ieee754_traits<Float>::format>::significand_bits;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<carrier_uint> significand_dist{
+		jkj::fp::detail::compute_power<digit_limit>(carrier_uint(10)),
+		std::numeric_limits<carrier_uint>::max() };
+	std::uniform_int_distribution<int> exponent_dist{ min_exponent, max_exponent };
+
+	bool success = true;
+	auto check = [&](carrier_uint significand, int exponent, bool is_negative) {
+		jkj::fp::signed_decimal_fp<Float> decimal;
+		decimal.significand = significand;
+		decimal.exponent = exponent;
+		decimal.is_negative = is_negative;
+		auto const str = std::string(decimal.is_negative ? "-" : "")
+			+ std::to_string(decimal.significand) + "e" + std::to_string(decimal.exponent);
+
+		auto const upward = strtof_with_rounding<Float>(str, FE_UPWARD);
+		auto const downward = strtof_with_rounding<Float>(str, FE_DOWNWARD);
+		auto const toward_zero = strtof_with_rounding<Float>(str, FE_TOWARDZERO);
+		auto const nearest = strtof_with_rounding<Float>(str, FE_TONEAREST);
+
+		auto compare = [&](char const* policy_name, jkj::fp::ieee754_bits<Float> expected,
+			jkj::fp::ieee754_bits<Float> computed)
+		{
+			if (computed.u != expected.u) {
+				std::cout << "Error detected! [policy = " << policy_name << ", input = " << str
+					<< ", expected = " << expected.u << ", computed = " << computed.u << "]\n";
+				success = false;
+			}
+		};
+
+		namespace br = jkj::fp::policy::binary_rounding;
+		compare("nearest_to_even", nearest, jkj::fp::to_binary_limited_precision(decimal));
+		compare("toward_plus_infinity", upward,
+			jkj::fp::to_binary_limited_precision(decimal, br::toward_plus_infinity));
+		compare("toward_minus_infinity", downward,
+			jkj::fp::to_binary_limited_precision(decimal, br::toward_minus_infinity));
+		compare("toward_zero", toward_zero,
+			jkj::fp::to_binary_limited_precision(decimal, br::toward_zero));
+		compare("nearest_to_even, cache::compact", nearest,
+			jkj::fp::to_binary_limited_precision(decimal, jkj::fp::policy::cache::compact));
+		if (std::to_string(significand).size() <= std::numeric_limits<carrier_uint>::digits10) {
+			compare("from_chars_limited", nearest,
+				jkj::fp::from_chars_limited<Float>(str.data(), str.data() + str.size()));
+		}
+	};
+
+	// Inputs with a decimal point and a long fractional part, which are parsed in
+	// chunks of many digits and so accumulate into an already nonzero value.
+	constexpr int max_digits = std::numeric_limits<carrier_uint>::digits10;
+	auto check_fixed_point = [&](carrier_uint significand, int integer_digits, int exponent) {
+		auto str = std::to_string(significand);
+		str.insert(std::size_t(integer_digits), 1, '.');
+		str += "e" + std::to_string(exponent);
+
+		auto const expected = strtof_with_rounding<Float>(str, FE_TONEAREST);
+		auto const computed = jkj::fp::from_chars_limited<Float>(str.data(), str.data() + str.size());
+		if (computed.u != expected.u) {
+			std::cout << "Error detected! [from_chars_limited, input = " << str
+				<< ", expected = " << expected.u << ", computed = " << computed.u << "]\n";
+			success = false;
+		}
+	};
+
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		bool const is_negative = rg() % 2 == 0;
+
+		// Up to 3 integer digits, with all of the remaining digits in the fraction.
+		int const digits = max_digits - 2 + int(rg() % 3);
+		carrier_uint lower = 1;
+		for (int j = 1; j < digits; ++j) {
+			lower *= 10;
+		}
+		auto const significand = std::uniform_int_distribution<carrier_uint>{
+			lower, carrier_uint(lower * 10 - 1) }(rg);
+		check_fixed_point(significand, 1 + int(rg() % 3), exponent_dist(rg) / 2);
+
+		// Random significands with more than digit_limit digits.
+		check(significand_dist(rg), exponent_dist(rg), is_negative);
+
+		// Exact middle points between adjacent floating-point numbers in
+		// [2^(carrier_bits - 2), 2^(carrier_bits - 1)), and their neighbors.
+		constexpr auto ulp = carrier_uint(1) << (carrier_bits - 2 - significand_bits);
+		auto const middle = ((carrier_uint(rg()) >> 2) | (carrier_uint(1) << (carrier_bits - 2)))
+			/ ulp * ulp + ulp / 2;
+		check(middle, 0, is_negative);
+		check(middle - 1, 0, is_negative);
+		check(middle + 1, 0, is_negative);
+	}
+
+	if (success) {
+		std::cout << "Wide significand random test for " << type_name_string
+			<< " with " << number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 1000000;
+
+	bool success = true;
+
+	std::cout << "[Testing Dooly with significands of full carrier precision...]\n";
+	success &= test<float>(number_of_samples, -60, 45, "binary32");
+	success &= test<double>(number_of_samples, -360, 330, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
@@ -0,0 +1,98 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/dragonbox.h"
+#include "random_float.h"
+#include <iostream>
+#include <vector>
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	constexpr auto decimal_digits = jkj::fp::ieee754_format_info<
+		jkj::fp::ieee754_traits<Float>::format>::decimal_digits;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+
+	// Samples from each of the distributions, and numbers with few digits,
+	// which often hit the integer checks.
+	std::vector<Float> samples;
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		samples.push_back(jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg));
+		samples.push_back(jkj::fp::detail::uniformly_randomly_generate_general_float<Float>(rg));
+		samples.push_back(jkj::fp::detail::randomly_generate_float_with_given_digits<Float>(
+			unsigned(rg() % decimal_digits) + 1, rg));
+		samples.push_back(Float(rg() % 100000) / Float(std::uint64_t(1) << (rg() % 24)));
+	}
+
+	bool success = true;
+	for (auto const x : samples) {
+		auto const br = ieee754_bits{ x };
+		if (!br.is_finite() || !br.is_nonzero()) {
+			continue;
+		}
+
+		auto compare = [&](char const* policy_name, auto... policies) {
+			auto const expected = jkj::fp::to_shortest_decimal(x, policies...);
+			auto const computed = jkj::fp::to_shortest_decimal(x,
+				jkj::fp::policy::branch_strategy::branchless, policies...);
+			if (computed.significand != expected.significand ||
+				computed.exponent != expected.exponent)
+			{
+				std::cout << "Error detected! [" << policy_name << ", x = " << br.u
+					<< ", expected = " << expected.significand << "E" << expected.exponent
+					<< ", computed = " << computed.significand << "E" << computed.exponent << "]\n";
+				success = false;
+			}
+		};
+
+		namespace policy = jkj::fp::policy;
+		compare("default");
+		compare("decimal_rounding::to_odd", policy::decimal_rounding::to_odd);
+		compare("decimal_rounding::toward_zero", policy::decimal_rounding::toward_zero);
+		compare("decimal_rounding::away_from_zero", policy::decimal_rounding::away_from_zero);
+		compare("binary_rounding::nearest_to_odd", policy::binary_rounding::nearest_to_odd);
+		compare("binary_rounding::nearest_toward_zero", policy::binary_rounding::nearest_toward_zero);
+		compare("binary_rounding::nearest_away_from_zero",
+			policy::binary_rounding::nearest_away_from_zero);
+		compare("trailing_zero::allow", policy::trailing_zero::allow);
+	}
+
+	if (success) {
+		std::cout << "Branchless evaluation test for " << type_name_string
+			<< " with " << samples.size() << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 1000000;
+
+	bool success = true;
+
+	std::cout << "[Testing the branchless evaluation...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
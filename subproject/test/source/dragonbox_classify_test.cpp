@@ -0,0 +1,144 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+
+#include "jkj/fp/to_chars/shortest_roundtrip.h"
+#include "random_float.h"
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// The previous to_chars_shortest_scientific_n, which tests the bits of x itself.
+template <class Float>
+static std::string reference_to_chars(Float x)
+{
+	auto const br = jkj::fp::ieee754_bits<Float>{ x };
+	if (br.is_nan()) {
+		return "NaN";
+	}
+
+	std::string str = br.is_negative() ? "-" : "";
+	if (!br.is_finite()) {
+		return str + "Infinity";
+	}
+	if (!br.is_nonzero()) {
+		return str + "0E0";
+	}
+
+	char buffer[64];
+	auto const end = jkj::fp::detail::to_chars_shortest_scientific_n_impl(
+		jkj::fp::to_shortest_decimal(x, jkj::fp::policy::sign::ignore), buffer);
+	return str + std::string(buffer, end);
+}
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	using carrier_uint = typename ieee754_bits::carrier_uint;
+	using value_class = jkj::fp::value_class;
+	namespace policy = jkj::fp::policy;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+
+	// Special values, the boundaries of the exponent range, and arbitrary bit patterns.
+	using limits = std::numeric_limits<Float>;
+	std::vector<Float> samples = {
+		Float(0), -Float(0), limits::infinity(), -limits::infinity(),
+		limits::quiet_NaN(), -limits::quiet_NaN(), limits::signaling_NaN(),
+		limits::denorm_min(), -limits::denorm_min(), limits::min(), -limits::min(),
+		limits::max(), -limits::max(), Float(1), Float(-1)
+	};
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		samples.push_back(ieee754_bits{ carrier_uint(rg()) }.to_float());
+	}
+
+	bool success = true;
+	for (auto const x : samples) {
+		auto const br = ieee754_bits{ x };
+
+		auto const expected_class = br.is_nan() ? value_class::nan
+			: !br.is_finite() ? value_class::infinity
+			: !br.is_nonzero() ? value_class::zero
+			: value_class::finite;
+
+		auto check = [&](char const* policy_name, auto const& computed, auto... policies) {
+			bool correct = computed.classification == expected_class &&
+				computed.is_negative == br.is_negative();
+			if (expected_class == value_class::finite) {
+				auto const expected = jkj::fp::to_shortest_decimal(x, policies...);
+				correct = correct && computed.significand == expected.significand &&
+					computed.exponent == expected.exponent;
+			}
+			else {
+				correct = correct && computed.significand == 0 && computed.exponent == 0;
+			}
+
+			if (!correct) {
+				std::cout << "Error detected! [" << policy_name << ", bits = " << br.u
+					<< ", computed = " << computed.significand << "E" << computed.exponent
+					<< ", class = " << int(computed.classification) << "]\n";
+				success = false;
+			}
+		};
+
+		check("default",
+			jkj::fp::to_shortest_decimal(x, policy::input_validation::classify));
+		check("toward_zero",
+			jkj::fp::to_shortest_decimal(x, policy::input_validation::classify,
+				policy::binary_rounding::toward_zero),
+			policy::binary_rounding::toward_zero);
+		check("integer_check::fast_path",
+			jkj::fp::to_shortest_decimal(x, policy::input_validation::classify,
+				policy::integer_check::fast_path),
+			policy::integer_check::fast_path);
+
+		char buffer[64];
+		auto const end = jkj::fp::to_chars_shortest_scientific_n(x, buffer);
+		auto const expected_str = reference_to_chars(x);
+		if (std::string(buffer, end) != expected_str) {
+			std::cout << "Error detected! [to_chars, bits = " << br.u
+				<< ", expected = " << expected_str
+				<< ", computed = " << std::string(buffer, end) << "]\n";
+			success = false;
+		}
+	}
+
+	if (success) {
+		std::cout << "Input classification test for " << type_name_string
+			<< " with " << samples.size() << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 1000000;
+
+	bool success = true;
+
+	std::cout << "[Testing input_validation::classify...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
@@ -0,0 +1,122 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+
+#include "jkj/fp/dragonbox.h"
+#include <cfenv>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+template <class Float>
+static Float strtof_with_rounding(std::string const& str, int mode)
+{
+	std::fesetround(mode);
+	Float result;
+	if constexpr (std::is_same_v<Float, float>) {
+		result = std::strtof(str.c_str(), nullptr);
+	}
+	else {
+		result = std::strtod(str.c_str(), nullptr);
+	}
+	std::fesetround(FE_TONEAREST);
+	return result;
+}
+
+template <class UInt>
+static std::string to_string(bool is_negative, UInt significand, int exponent)
+{
+	return std::string(is_negative ? "-" : "") + std::to_string(significand)
+		+ "e" + std::to_string(exponent);
+}
+
+// Checks that the result of the directed rounding reads back to x when rounded in the
+// given mode, and that neither of the closest decimals with one fewer digit does.
+template <class Float, class Policy>
+static bool check(Float x, char const* policy_name, Policy policy, int mode)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	auto const result = jkj::fp::to_shortest_decimal(x, policy);
+
+	bool success = strtof_with_rounding<Float>(
+		to_string(result.is_negative, result.significand, result.exponent), mode) == x;
+	if (result.significand >= 10) {
+		auto const shorter = result.significand / 10;
+		success &= strtof_with_rounding<Float>(
+			to_string(result.is_negative, shorter, result.exponent + 1), mode) != x;
+		success &= strtof_with_rounding<Float>(
+			to_string(result.is_negative, shorter + 1, result.exponent + 1), mode) != x;
+	}
+
+	if (!success) {
+		std::cout << "Error detected! [" << policy_name << ", bits = " << ieee754_bits{ x }.u
+			<< ", computed = " << result.significand << "E" << result.exponent << "]\n";
+	}
+	return success;
+}
+
+template <class Float, class TypenameString>
+static bool test(TypenameString&& type_name_string)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	using carrier_uint = typename ieee754_bits::carrier_uint;
+	using format_info = jkj::fp::ieee754_format_info<jkj::fp::ieee754_traits<Float>::format>;
+	namespace br = jkj::fp::policy::binary_rounding;
+
+	bool success = true;
+	auto check_all = [&](Float x) {
+		success &= check(x, "toward_plus_infinity", br::toward_plus_infinity, FE_UPWARD);
+		success &= check(x, "toward_minus_infinity", br::toward_minus_infinity, FE_DOWNWARD);
+		success &= check(x, "toward_zero", br::toward_zero, FE_TOWARDZERO);
+		success &= check(x, "away_from_zero", br::away_from_zero,
+			x < 0 ? FE_DOWNWARD : FE_UPWARD);
+	};
+
+	// Every power of 2 including the smallest normal number, whose predecessor is subnormal,
+	// and the numbers next to them.
+	constexpr unsigned int max_exponent_bits = (1u << format_info::exponent_bits) - 2;
+	for (unsigned int exponent_bits = 1; exponent_bits <= max_exponent_bits; ++exponent_bits) {
+		auto const bits = carrier_uint(carrier_uint(exponent_bits) << format_info::significand_bits);
+		for (auto const u : { carrier_uint(bits - 1), bits, carrier_uint(bits + 1) }) {
+			auto const x = ieee754_bits{ u }.to_float();
+			check_all(x);
+			check_all(-x);
+		}
+	}
+
+	if (success) {
+		std::cout << "Directed rounding test around powers of 2 for " << type_name_string
+			<< " succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	bool success = true;
+
+	std::cout << "[Testing directed rounding around powers of 2...]\n";
+	success &= test<float>("binary32");
+	success &= test<double>("binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
@@ -0,0 +1,89 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/dragonbox.h"
+#include "random_float.h"
+#include <iostream>
+
+static bool same_entry(std::uint64_t a, std::uint64_t b) {
+	return a == b;
+}
+static bool same_entry(jkj::fp::detail::wuint::uint128 a, jkj::fp::detail::wuint::uint128 b) {
+	return a.high() == b.high() && a.low() == b.low();
+}
+
+template <class Float, int min_decimal_exponent, int max_decimal_exponent, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	constexpr auto format = jkj::fp::ieee754_traits<Float>::format;
+	using cache_holder = jkj::fp::detail::dragonbox::cache_holder<format>;
+	namespace policy = jkj::fp::policy;
+	constexpr auto hot_range = policy::cache::hot_range<min_decimal_exponent, max_decimal_exponent>;
+
+	bool success = true;
+
+	// Every entry should be the same as the one in the full table.
+	for (int k = cache_holder::min_k; k <= cache_holder::max_k; ++k) {
+		if (!same_entry(hot_range.template get_cache<format>(k),
+			policy::cache::fast.template get_cache<format>(k)))
+		{
+			std::cout << "Error detected! [k = " << k << "]\n";
+			success = false;
+		}
+	}
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+		auto const expected = jkj::fp::to_shortest_decimal(x);
+		auto const computed = jkj::fp::to_shortest_decimal(x, hot_range);
+		if (computed.significand != expected.significand || computed.exponent != expected.exponent ||
+			computed.is_negative != expected.is_negative)
+		{
+			std::cout << "Error detected! [x = " << ieee754_bits{ x }.u << "]\n";
+			success = false;
+		}
+	}
+
+	if (success) {
+		std::cout << "Hot range cache test for " << type_name_string << " with range ["
+			<< min_decimal_exponent << ", " << max_decimal_exponent << "] and "
+			<< number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 1000000;
+
+	bool success = true;
+
+	std::cout << "[Testing the hot range cache...]\n";
+	success &= test<float, -9, 12>(number_of_samples, "binary32");
+	success &= test<float, -100, 100>(number_of_samples, "binary32");
+	success &= test<double, -9, 12>(number_of_samples, "binary64");
+	success &= test<double, 300, 400>(number_of_samples, "binary64");
+	success &= test<double, -400, -300>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
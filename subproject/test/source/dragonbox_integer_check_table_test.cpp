@@ -0,0 +1,94 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/dragonbox.h"
+#include "random_float.h"
+#include <iostream>
+
+// Compares the table-driven integer checks with the threshold-based ones.
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples_per_exponent, TypenameString&& type_name_string)
+{
+	using impl = jkj::fp::detail::dragonbox::impl<Float>;
+	using case_id = typename impl::integer_check_case_id;
+	using carrier_uint = typename impl::carrier_uint;
+	constexpr auto significand_bits = impl::significand_bits;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+
+	bool success = true;
+	for (int exponent = impl::min_exponent - significand_bits;
+		exponent <= impl::max_exponent - significand_bits; ++exponent)
+	{
+		int const minus_k = jkj::fp::detail::log::floor_log10_pow2(exponent) - impl::kappa;
+
+		for (std::size_t i = 0; i < number_of_samples_per_exponent; ++i) {
+			// Random numbers with many trailing zeros or many factors of 5.
+			auto two_f = carrier_uint(rg()) >> (jkj::fp::ieee754_traits<Float>::carrier_bits -
+				significand_bits - 2);
+			auto const shift = int(rg() % (significand_bits + 2));
+			two_f = (two_f >> shift) << shift;
+			if (rg() % 2 == 0) {
+				auto const power_of_5 = int(rg() % (impl::max_power_of_factor_of_5 + 1));
+				carrier_uint multiplier = 1;
+				for (int j = 0; j < power_of_5; ++j) {
+					multiplier *= 5;
+				}
+				two_f = (two_f / multiplier) * multiplier;
+			}
+			if (two_f == 0) {
+				continue;
+			}
+
+			auto compare = [&](char const* name, bool expected, bool computed) {
+				if (expected != computed) {
+					std::cout << "Error detected! [" << name << ", exponent = " << exponent
+						<< ", two_f = " << two_f << "]\n";
+					success = false;
+				}
+			};
+			compare("fc_pm_half",
+				impl::template is_product_integer<case_id::fc_pm_half>(two_f, exponent, minus_k),
+				impl::template is_product_integer<case_id::fc_pm_half>(two_f, exponent));
+			compare("fc",
+				impl::template is_product_integer<case_id::fc>(two_f, exponent, minus_k),
+				impl::template is_product_integer<case_id::fc>(two_f, exponent));
+		}
+	}
+
+	if (success) {
+		std::cout << "Integer check table test for " << type_name_string << " succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples_per_exponent = 10000;
+
+	bool success = true;
+
+	std::cout << "[Testing the integer check tables...]\n";
+	success &= test<float>(number_of_samples_per_exponent, "binary32");
+	success &= test<double>(number_of_samples_per_exponent, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
@@ -0,0 +1,118 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/dragonbox.h"
+#include "random_float.h"
+#include <iostream>
+#include <vector>
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	using carrier_uint = typename ieee754_bits::carrier_uint;
+	constexpr auto significand_bits = jkj::fp::ieee754_format_info<
+		jkj::fp::ieee754_traits<Float>::format>::significand_bits;
+	constexpr auto max_integer = carrier_uint(1) << (significand_bits + 1);
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+
+	// Integers of all magnitudes, the numbers around the limit, and arbitrary numbers.
+	std::vector<Float> samples = {
+		Float(1), Float(10), Float(1000), Float(0.5), Float(max_integer - 1), Float(max_integer),
+		Float(max_integer + 2), Float(max_integer) * 10, Float(1e20f)
+	};
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto const digits = int(rg() % (significand_bits + 1));
+		auto const n = carrier_uint(rg()) & ((carrier_uint(1) << digits) - 1);
+		samples.push_back(Float(n == 0 ? 1 : n) * (rg() % 2 == 0 ? 1 : -1));
+		samples.push_back(Float(n == 0 ? 1 : n) * Float(rg() % 2 == 0 ? 1000 : 0.25));
+		samples.push_back(jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg));
+	}
+
+	bool success = true;
+	for (auto const x : samples) {
+		if (!ieee754_bits{ x }.is_nonzero()) {
+			continue;
+		}
+
+		auto compare = [&](char const* policy_name, auto... policies) {
+			auto const expected = jkj::fp::to_shortest_decimal(x, policies...);
+			auto const computed = jkj::fp::to_shortest_decimal(x,
+				jkj::fp::policy::integer_check::fast_path, policies...);
+			if (computed.significand != expected.significand ||
+				computed.exponent != expected.exponent)
+			{
+				std::cout << "Error detected! [" << policy_name << ", x = " << x
+					<< ", expected = " << expected.significand << "E" << expected.exponent
+					<< ", computed = " << computed.significand << "E" << computed.exponent << "]\n";
+				success = false;
+			}
+			return computed;
+		};
+
+		namespace policy = jkj::fp::policy;
+		auto const result = compare("default");
+		if (result.is_negative != ieee754_bits{ x }.is_negative()) {
+			std::cout << "Error detected! [sign, x = " << x << "]\n";
+			success = false;
+		}
+		compare("toward_zero", policy::binary_rounding::toward_zero);
+		compare("toward_plus_infinity", policy::binary_rounding::toward_plus_infinity);
+		compare("nearest_toward_zero", policy::binary_rounding::nearest_toward_zero);
+		compare("sign::ignore", policy::sign::ignore);
+
+		// Without removing trailing zeros, the value should be the same.
+		auto const with_zeros = jkj::fp::to_shortest_decimal(x,
+			policy::integer_check::fast_path, policy::trailing_zero::report);
+		auto significand = with_zeros.significand;
+		auto exponent = with_zeros.exponent;
+		while (significand % 10 == 0) {
+			significand /= 10;
+			++exponent;
+		}
+		if (significand != result.significand || exponent != result.exponent ||
+			(significand != with_zeros.significand && !with_zeros.may_have_trailing_zeros))
+		{
+			std::cout << "Error detected! [trailing_zero::report, x = " << x << "]\n";
+			success = false;
+		}
+	}
+
+	if (success) {
+		std::cout << "Integer fast path test for " << type_name_string
+			<< " with " << samples.size() << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 1000000;
+
+	bool success = true;
+
+	std::cout << "[Testing the integer fast path...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
@@ -0,0 +1,153 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+
+#include "jkj/fp/to_chars/runtime_policy.h"
+#include "jkj/fp/to_chars/shortest_roundtrip.h"
+#include "random_float.h"
+#include <iostream>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Calls f with each element of the tuple.
+template <class Tuple, class Func>
+static void for_each(Tuple const& t, Func&& f)
+{
+	std::apply([&f](auto const&... elements) { (f(elements), ...); }, t);
+}
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	using runtime_policy = jkj::fp::runtime_policy;
+	namespace policy = jkj::fp::policy;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+
+	using limits = std::numeric_limits<Float>;
+	std::vector<Float> samples = {
+		Float(0), -Float(0), limits::infinity(), -limits::infinity(), limits::quiet_NaN(),
+		limits::denorm_min(), limits::min(), limits::max(), Float(1), Float(-1e10)
+	};
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		samples.push_back(jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg));
+		samples.push_back(jkj::fp::detail::randomly_generate_float_with_given_digits<Float>(
+			int(rg() % (std::numeric_limits<Float>::max_digits10 - 1)) + 1, rg));
+	}
+
+	// Each enumerator of runtime_policy paired with the corresponding policy.
+	using br = runtime_policy::binary_rounding_t;
+	auto const binary_roundings = std::make_tuple(
+		std::make_pair(br::nearest_to_even, policy::binary_rounding::nearest_to_even),
+		std::make_pair(br::nearest_to_odd, policy::binary_rounding::nearest_to_odd),
+		std::make_pair(br::nearest_toward_plus_infinity,
+			policy::binary_rounding::nearest_toward_plus_infinity),
+		std::make_pair(br::nearest_toward_minus_infinity,
+			policy::binary_rounding::nearest_toward_minus_infinity),
+		std::make_pair(br::nearest_toward_zero, policy::binary_rounding::nearest_toward_zero),
+		std::make_pair(br::nearest_away_from_zero, policy::binary_rounding::nearest_away_from_zero),
+		std::make_pair(br::toward_plus_infinity, policy::binary_rounding::toward_plus_infinity),
+		std::make_pair(br::toward_minus_infinity, policy::binary_rounding::toward_minus_infinity),
+		std::make_pair(br::toward_zero, policy::binary_rounding::toward_zero),
+		std::make_pair(br::away_from_zero, policy::binary_rounding::away_from_zero));
+
+	using dr = runtime_policy::decimal_rounding_t;
+	auto const decimal_roundings = std::make_tuple(
+		std::make_pair(dr::do_not_care, policy::decimal_rounding::do_not_care),
+		std::make_pair(dr::to_even, policy::decimal_rounding::to_even),
+		std::make_pair(dr::to_odd, policy::decimal_rounding::to_odd),
+		std::make_pair(dr::away_from_zero, policy::decimal_rounding::away_from_zero),
+		std::make_pair(dr::toward_zero, policy::decimal_rounding::toward_zero));
+
+	using tz = runtime_policy::trailing_zero_t;
+	auto const trailing_zeros = std::make_tuple(
+		std::make_pair(tz::allow, policy::trailing_zero::allow),
+		std::make_pair(tz::remove, policy::trailing_zero::remove));
+
+	using ca = runtime_policy::cache_t;
+	auto const caches = std::make_tuple(
+		std::make_pair(ca::fast, policy::cache::fast),
+		std::make_pair(ca::compact, policy::cache::compact));
+
+	bool success = true;
+	for_each(binary_roundings, [&](auto const& b) {
+		for_each(decimal_roundings, [&](auto const& d) {
+			for_each(trailing_zeros, [&](auto const& t) {
+				for_each(caches, [&](auto const& c) {
+					runtime_policy const rp{ b.first, d.first, t.first, c.first };
+
+					for (auto const x : samples) {
+						auto const expected = jkj::fp::to_shortest_decimal(x,
+							policy::input_validation::classify,
+							b.second, d.second, t.second, c.second);
+						auto const computed = jkj::fp::to_shortest_decimal(x, rp);
+
+						char expected_str[64];
+						char computed_str[64];
+						auto const expected_end = jkj::fp::detail::
+							to_chars_shortest_scientific_n_impl(expected, expected_str);
+						auto const computed_end = jkj::fp::to_chars_shortest_scientific_n(x,
+							computed_str, rp);
+
+						if (computed.classification != expected.classification ||
+							computed.is_negative != expected.is_negative ||
+							computed.significand != expected.significand ||
+							computed.exponent != expected.exponent ||
+							std::string(expected_str, expected_end) !=
+								std::string(computed_str, computed_end))
+						{
+							std::cout << "Error detected! [policy = (" << int(b.first) << ", "
+								<< int(d.first) << ", " << int(t.first) << ", " << int(c.first)
+								<< "), bits = " << ieee754_bits{ x }.u
+								<< ", expected = " << expected.significand << "E" << expected.exponent
+								<< ", computed = " << computed.significand << "E" << computed.exponent
+								<< "]\n";
+							success = false;
+						}
+					}
+				});
+			});
+		});
+	});
+
+	if (success) {
+		std::cout << "Runtime policy test for " << type_name_string
+			<< " with " << samples.size() << " examples for each policy succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 10000;
+
+	bool success = true;
+
+	std::cout << "[Testing the runtime policy dispatch...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
@@ -58,6 +58,48 @@ static bool test_all_shorter_interval_cases_impl()
 		}
 	}
 
+	// The table lookup should give the same results for any rounding policies.
+	for (carrier_uint exponent_bits = 1;
+		exponent_bits < (carrier_uint(1) << ieee754_format_info::exponent_bits) - 1; ++exponent_bits)
+	{
+		for (carrier_uint sign_bit : { carrier_uint(0), ieee754_traits::negative_zero() }) {
+			auto const x = jkj::fp::ieee754_bits<Float>{
+				carrier_uint(sign_bit | (exponent_bits << ieee754_format_info::significand_bits)) }
+			.to_float();
+
+			auto compare_with_table = [&](auto... policies) {
+				auto const computed = jkj::fp::to_shortest_decimal(x,
+					jkj::fp::policy::cache::fast, policies...);
+				auto const looked_up = jkj::fp::to_shortest_decimal(x,
+					jkj::fp::policy::cache::shorter_interval_table, policies...);
+				if (computed.significand != looked_up.significand ||
+					computed.exponent != looked_up.exponent ||
+					computed.is_negative != looked_up.is_negative)
+				{
+					std::cout << "Error detected! [exponent bits = " << exponent_bits
+						<< ", computed = " << computed.significand << "E" << computed.exponent
+						<< ", looked up = " << looked_up.significand << "E" << looked_up.exponent
+						<< "]\n";
+					success = false;
+				}
+			};
+
+			namespace binary_rounding = jkj::fp::policy::binary_rounding;
+			namespace decimal_rounding = jkj::fp::policy::decimal_rounding;
+			compare_with_table();
+			compare_with_table(binary_rounding::nearest_to_odd, decimal_rounding::to_odd);
+			compare_with_table(binary_rounding::nearest_toward_plus_infinity,
+				decimal_rounding::toward_zero);
+			compare_with_table(binary_rounding::nearest_toward_minus_infinity,
+				decimal_rounding::away_from_zero);
+			compare_with_table(binary_rounding::nearest_toward_zero, decimal_rounding::do_not_care);
+			compare_with_table(binary_rounding::nearest_away_from_zero);
+			compare_with_table(binary_rounding::nearest_to_even_static_boundary);
+			compare_with_table(binary_rounding::nearest_to_odd_static_boundary,
+				decimal_rounding::to_odd);
+		}
+	}
+
 	if (success) {
 		std::cout << "All cases are verified.\n";
 	}
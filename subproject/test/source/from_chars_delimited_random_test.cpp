@@ -0,0 +1,182 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/from_chars/from_chars_delimited.h"
+#include "jkj/fp/to_chars/fixed_precision.h"
+#include "random_float.h"
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+template <class Float>
+static bool same_bits(Float x, Float y)
+{
+	return jkj::fp::ieee754_bits<Float>{ x }.u == jkj::fp::ieee754_bits<Float>{ y }.u;
+}
+
+template <class Float, class TypenameString>
+bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<int> precision_dist{ 0, 40 };
+	std::uniform_int_distribution<int> kind_dist{ 0, 19 };
+	char const delimiters[] = ",;\n";
+	std::uniform_int_distribution<std::size_t> delimiter_dist{ 0, std::strlen(delimiters) - 1 };
+	char const* const malformed[] = { "abc", "1.2.3", "-", ".", "1e", "e5", "1e+", "0x10", "1 2" };
+	std::uniform_int_distribution<std::size_t> malformed_dist{ 0,
+		sizeof(malformed) / sizeof(malformed[0]) - 1 };
+	auto const nan = std::numeric_limits<Float>::quiet_NaN();
+
+	// Generate the input, with empty fields, malformed fields, and blanks around fields.
+	std::string input;
+	std::vector<Float> expected;
+	std::vector<std::size_t> expected_invalid_fields;
+	char buffer[1024];
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto const kind = kind_dist(rg);
+		if (kind == 0) {
+			expected_invalid_fields.push_back(i);
+			expected.push_back(nan);
+		}
+		else if (kind == 1) {
+			input += malformed[malformed_dist(rg)];
+			expected_invalid_fields.push_back(i);
+			expected.push_back(nan);
+		}
+		else {
+			auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+			auto const last = jkj::fp::to_chars_fixed_precision_scientific_n(x, buffer,
+				precision_dist(rg));
+			expected.push_back(jkj::fp::from_chars_unlimited<Float>(buffer, last).to_float());
+			if (kind == 2) {
+				input += ' ';
+			}
+			input.append(buffer, last);
+			if (kind == 3) {
+				input += " \r";
+			}
+		}
+		input += delimiters[delimiter_dist(rg)];
+	}
+
+	bool success = true;
+	auto check = [&](std::vector<Float> const& results, std::size_t count,
+		std::vector<std::size_t> const& invalid_fields, char const* description)
+	{
+		if (invalid_fields != expected_invalid_fields) {
+			std::cout << "Error detected! [" << description << ", expected "
+				<< expected_invalid_fields.size() << " invalid fields, but got "
+				<< invalid_fields.size() << "]\n";
+			success = false;
+			return;
+		}
+		for (std::size_t i = 0; i < count; ++i) {
+			if (!same_bits(expected[i], results[i])) {
+				std::cout << "Error detected! [" << description << ", field " << i
+					<< ", expected = " << jkj::fp::ieee754_bits<Float>{ expected[i] }.u
+					<< ", computed = " << jkj::fp::ieee754_bits<Float>{ results[i] }.u << "]\n";
+				success = false;
+				return;
+			}
+		}
+	};
+
+	for (unsigned int number_of_threads = 1; number_of_threads <= 8; ++number_of_threads) {
+		auto const description = "threads = " + std::to_string(number_of_threads);
+		jkj::fp::from_chars_thread_pool pool{ number_of_threads };
+
+		std::vector<std::size_t> invalid_fields;
+		auto const results = jkj::fp::from_chars_delimited<Float>(input.data(),
+			input.data() + input.size(), delimiters, pool, &invalid_fields);
+		if (results.size() != expected.size()) {
+			std::cout << "Error detected! [" << description << ", expected "
+				<< expected.size() << " numbers, but got " << results.size() << "]\n";
+			success = false;
+			continue;
+		}
+		check(results, results.size(), invalid_fields, description.c_str());
+
+		// Write into a buffer shorter than the input, reusing the pool.
+		std::vector<Float> partial_results(expected.size() / 3);
+		auto const count = jkj::fp::from_chars_delimited<Float>(input.data(),
+			input.data() + input.size(), delimiters, partial_results.data(),
+			partial_results.size(), pool, &invalid_fields);
+		if (count != expected.size()) {
+			std::cout << "Error detected! [" << description << ", expected "
+				<< expected.size() << " numbers, but got " << count << "]\n";
+			success = false;
+			continue;
+		}
+		check(partial_results, partial_results.size(), invalid_fields, description.c_str());
+	}
+
+	if (success) {
+		std::cout << "Delimited parsing random test for " << type_name_string
+			<< " with " << number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+// A CSV with a header row, empty cells, and \r\n line endings.
+template <class Float, class TypenameString>
+bool test_csv(TypenameString&& type_name_string)
+{
+	std::string const input = "x,y,z\r\n1,,3\r\n4,5,6\r\n,,\r\n7,8,abc\r\n";
+	auto const nan = std::numeric_limits<Float>::quiet_NaN();
+	std::vector<Float> const expected = {
+		nan, nan, nan, 1, nan, 3, 4, 5, 6, nan, nan, nan, 7, 8, nan };
+	std::vector<std::size_t> const expected_invalid_fields = { 0, 1, 2, 4, 9, 10, 11, 14 };
+
+	std::vector<std::size_t> invalid_fields;
+	auto const results = jkj::fp::from_chars_delimited<Float>(input.data(),
+		input.data() + input.size(), ",\n", 0, &invalid_fields);
+
+	bool success = results.size() == expected.size() &&
+		invalid_fields == expected_invalid_fields;
+	for (std::size_t i = 0; success && i < results.size(); ++i) {
+		success = same_bits(expected[i], results[i]);
+	}
+
+	if (success) {
+		std::cout << "CSV test for " << type_name_string << " succeeded.\n";
+	}
+	else {
+		std::cout << "Error detected! [CSV test for " << type_name_string << "]\n";
+	}
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 100000;
+
+	bool success = true;
+
+	std::cout << "[Testing from_chars_delimited...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	success &= test_csv<float>("binary32");
+	success &= test_csv<double>("binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
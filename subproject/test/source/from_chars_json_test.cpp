@@ -0,0 +1,164 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/from_chars/from_chars_json.h"
+#include "random_float.h"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// Generates a random number in the JSON grammar.
+static std::string generate_random_json_number(std::mt19937_64& rg)
+{
+	std::uniform_int_distribution<int> digit_count_dist{ 1, 40 };
+	std::uniform_int_distribution<int> exponent_dist{ -400, 400 };
+
+	auto append_digits = [&](std::string& str, int count) {
+		for (int i = 0; i < count; ++i) {
+			// Lots of zeros and nines to produce interesting significands.
+			switch (rg() % 4) {
+			case 0:
+				str += '0';
+				break;
+			case 1:
+				str += '9';
+				break;
+			default:
+				str += char('0' + rg() % 10);
+			}
+		}
+	};
+
+	std::string str = rg() % 2 == 0 ? "" : "-";
+	if (rg() % 4 == 0) {
+		str += '0';
+	}
+	else {
+		str += char('1' + rg() % 9);
+		append_digits(str, digit_count_dist(rg) - 1);
+	}
+	if (rg() % 2 == 0) {
+		str += '.';
+		append_digits(str, digit_count_dist(rg));
+	}
+	if (rg() % 2 == 0) {
+		str += rg() % 2 == 0 ? 'e' : 'E';
+		switch (rg() % 3) {
+		case 0:
+			str += '-';
+			break;
+		case 1:
+			str += '+';
+			break;
+		}
+		auto const exp = std::abs(exponent_dist(rg));
+		// Leading zeros are allowed in the exponent.
+		if (rg() % 8 == 0) {
+			str += '0';
+		}
+		str += std::to_string(exp);
+	}
+	return str;
+}
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	char const terminators[] = ",]} \n";
+
+	bool success = true;
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto const number = generate_random_json_number(rg);
+		auto const input = number + terminators[rg() % (sizeof(terminators) - 1)];
+
+		auto const expected = jkj::fp::ieee754_bits<Float>{ std::is_same_v<Float, float> ?
+			Float(std::strtof(number.c_str(), nullptr)) :
+			Float(std::strtod(number.c_str(), nullptr)) };
+		auto const computed =
+			jkj::fp::from_chars_json<Float>(input.data(), input.data() + input.size());
+
+		if (computed.ec != jkj::fp::json_number_errc::none ||
+			computed.ptr != input.data() + number.size() || computed.value.u != expected.u)
+		{
+			std::cout << "Error detected! [input = " << number << ", expected = " << expected.u
+				<< ", computed = " << computed.value.u << ", error code = " << int(computed.ec)
+				<< ", length = " << (computed.ptr - input.data()) << "]\n";
+			success = false;
+		}
+	}
+
+	// Malformed inputs, with the expected error code and error position.
+	struct malformed_input {
+		std::string_view input;
+		jkj::fp::json_number_errc ec;
+		std::size_t position;
+	};
+	using errc = jkj::fp::json_number_errc;
+	malformed_input const malformed_inputs[] = {
+		{ "", errc::missing_integer_part, 0 },
+		{ "-", errc::missing_integer_part, 1 },
+		{ "+1", errc::missing_integer_part, 0 },
+		{ ".5", errc::missing_integer_part, 0 },
+		{ "-.5", errc::missing_integer_part, 1 },
+		{ "--1", errc::missing_integer_part, 1 },
+		{ "inf", errc::missing_integer_part, 0 },
+		{ "01", errc::leading_zero, 1 },
+		{ "-00.5", errc::leading_zero, 2 },
+		{ "1.", errc::missing_fractional_part, 2 },
+		{ "1.e5", errc::missing_fractional_part, 2 },
+		{ "0.,", errc::missing_fractional_part, 2 },
+		{ "1e", errc::missing_exponent_part, 2 },
+		{ "1E+", errc::missing_exponent_part, 3 },
+		{ "1.5e-]", errc::missing_exponent_part, 5 },
+		{ "1e--5", errc::missing_exponent_part, 3 }
+	};
+	for (auto const& m : malformed_inputs) {
+		auto const computed = jkj::fp::from_chars_json<Float>(m.input.data(),
+			m.input.data() + m.input.size());
+		if (computed.ec != m.ec || computed.ptr != m.input.data() + m.position) {
+			std::cout << "Error detected! [input = " << m.input << ", expected error code = "
+				<< int(m.ec) << " at " << m.position << ", computed error code = "
+				<< int(computed.ec) << " at " << (computed.ptr - m.input.data()) << "]\n";
+			success = false;
+		}
+	}
+
+	if (success) {
+		std::cout << "JSON number parsing test for " << type_name_string
+			<< " with " << number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 1000000;
+
+	bool success = true;
+
+	std::cout << "[Testing from_chars_json...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
@@ -0,0 +1,194 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/from_chars/from_chars.h"
+#include "jkj/fp/to_chars/fixed_precision.h"
+#include "random_float.h"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+struct decomposed_number {
+	bool is_negative;
+	std::string integer_part;
+	std::string fractional_part;
+	int exponent;
+};
+
+// Splits the digits of a random number at a random position.
+template <class Float>
+static decomposed_number generate_random_number(int digits, std::mt19937_64& rg)
+{
+	char buffer[1024];
+	auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+	auto const last = jkj::fp::to_chars_fixed_precision_scientific_n(x, buffer, digits - 1);
+
+	std::string all_digits;
+	char* ptr = buffer[0] == '-' ? buffer + 1 : buffer;
+	for (; *ptr != 'e'; ++ptr) {
+		if (*ptr != '.') {
+			all_digits += *ptr;
+		}
+	}
+	auto const dot_pos = std::uniform_int_distribution<int>{ 0, digits }(rg);
+
+	decomposed_number result;
+	result.is_negative = buffer[0] == '-';
+	result.integer_part = dot_pos == 0 ? "0" : all_digits.substr(0, std::size_t(dot_pos));
+	result.fractional_part = all_digits.substr(std::size_t(dot_pos));
+	// Drop the exponent half of the time; the reference is built from the same decomposition,
+	// so the value need not be that of x.
+	result.exponent = rg() % 2 == 0 ? 0 :
+		std::atoi(std::string(ptr + 1, last).c_str()) + 1 - dot_pos;
+	return result;
+}
+
+// Inserts separators at every third digit counted from the decimal point.
+static std::string group_by_three(std::string const& digits, char separator, bool from_left)
+{
+	std::string result;
+	for (std::size_t i = 0; i < digits.size(); ++i) {
+		auto const position = from_left ? i : digits.size() - i;
+		if (i != 0 && position % 3 == 0) {
+			result += separator;
+		}
+		result += digits[i];
+	}
+	return result;
+}
+
+// Inserts separators at random positions between digits.
+static std::string insert_randomly(std::string const& digits, char separator,
+	std::mt19937_64& rg)
+{
+	std::string result;
+	for (std::size_t i = 0; i < digits.size(); ++i) {
+		if (i != 0 && rg() % 3 == 0) {
+			result += separator;
+		}
+		result += digits[i];
+	}
+	return result;
+}
+
+static std::string compose(decomposed_number const& n, std::string const& integer_part,
+	char decimal_point, std::string const& fractional_part, bool force_exponent = false)
+{
+	std::string result = n.is_negative ? "-" : "";
+	result += integer_part;
+	if (!fractional_part.empty()) {
+		result += decimal_point;
+		result += fractional_part;
+	}
+	if (force_exponent || n.exponent != 0) {
+		result += 'e';
+		result += std::to_string(n.exponent);
+	}
+	return result;
+}
+
+template <class Float, class TypenameString>
+bool test(std::size_t number_of_samples, int max_digits, TypenameString&& type_name_string)
+{
+	constexpr auto digit_limit =
+		jkj::fp::to_binary_limited_precision_digit_limit<jkj::fp::ieee754_traits<Float>::format>;
+	using european_format = jkj::fp::parse_format<',', '.',
+		jkj::fp::digit_grouping::every_third_digit>;
+	using underscore_format = jkj::fp::parse_format<'.', '_'>;
+	using scientific_format = jkj::fp::parse_format<'.', '\0',
+		jkj::fp::digit_grouping::ignore, jkj::fp::exponent_part::required>;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	bool success = true;
+
+	auto check = [&](std::string const& input, std::string const& reference, auto format) {
+		using format_t = decltype(format);
+		auto const expected = jkj::fp::from_chars_unlimited<Float>(
+			reference.data(), reference.data() + reference.size());
+
+		auto const computed = jkj::fp::from_chars_unlimited<Float, format_t>(
+			input.data(), input.data() + input.size());
+		if (expected.u != computed.u) {
+			std::cout << "Error detected! [input = " << input << ", reference = " << reference
+				<< ", expected = " << expected.u << ", computed = " << computed.u << "]\n";
+			success = false;
+		}
+
+		// Leading zeros in the integer part do not count.
+		int digits = 0;
+		for (auto c : reference.substr(0, reference.find('e'))) {
+			digits += jkj::fp::detail::is_decimal_digit(c) ? 1 : 0;
+		}
+		if (reference[reference[0] == '-' ? 1 : 0] == '0') {
+			--digits;
+		}
+		if (digits <= digit_limit) {
+			auto const computed_limited = jkj::fp::from_chars_limited<Float, format_t>(
+				input.data(), input.data() + input.size());
+			if (expected.u != computed_limited.u) {
+				std::cout << "Error detected! [input = " << input << ", reference = "
+					<< reference << ", expected = " << expected.u
+					<< ", computed (limited) = " << computed_limited.u << "]\n";
+				success = false;
+			}
+		}
+	};
+
+	for (int digits = 1; digits <= max_digits; ++digits) {
+		for (std::size_t i = 0; i < number_of_samples; ++i) {
+			auto n = generate_random_number<Float>(digits, rg);
+			auto const reference = compose(n, n.integer_part, '.', n.fractional_part);
+
+			// 1.234.567,891.2e-10
+			check(compose(n, group_by_three(n.integer_part, '.', false), ',',
+				group_by_three(n.fractional_part, '.', true)),
+				reference, european_format{});
+			// 1.234.567,8912e-10
+			check(compose(n, group_by_three(n.integer_part, '.', false), ',',
+				n.fractional_part), reference, european_format{});
+			// 1_23_4567.89_1_2e-10
+			check(compose(n, insert_randomly(n.integer_part, '_', rg), '.',
+				insert_randomly(n.fractional_part, '_', rg)),
+				reference, underscore_format{});
+			// 1234567.8912e0
+			check(compose(n, n.integer_part, '.', n.fractional_part, true),
+				reference, scientific_format{});
+		}
+	}
+
+	if (success) {
+		std::cout << "Parse format test for " << type_name_string
+			<< " with " << number_of_samples << " examples per digit count succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 10000;
+	bool success = true;
+
+	std::cout << "[Testing from_chars with custom parse formats...]\n";
+	success &= test<float>(number_of_samples, 30, "binary32");
+	success &= test<double>(number_of_samples, 30, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
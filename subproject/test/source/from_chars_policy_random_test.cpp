@@ -0,0 +1,246 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/from_chars/from_chars.h"
+#include "jkj/fp/to_chars/fixed_precision.h"
+#include "random_float.h"
+#include <cfenv>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+// A floating-point type that can represent every middle point of two adjacent Float's.
+template <class Float>
+using wider_float = std::conditional_t<std::is_same_v<Float, float>, double, long double>;
+
+template <class Float>
+static jkj::fp::ieee754_bits<Float> strtof_with_rounding(std::string const& str, int mode)
+{
+	std::fesetround(mode);
+	Float result;
+	if constexpr (std::is_same_v<Float, float>) {
+		result = std::strtof(str.c_str(), nullptr);
+	}
+	else {
+		result = std::strtod(str.c_str(), nullptr);
+	}
+	std::fesetround(FE_TONEAREST);
+	return jkj::fp::ieee754_bits<Float>{ result };
+}
+
+// Prints the exact value of x.
+template <class Float>
+static std::string print_exactly(wider_float<Float> x)
+{
+	char buffer[2048];
+	if constexpr (std::is_same_v<Float, float>) {
+		std::snprintf(buffer, sizeof(buffer), "%.200e", x);
+	}
+	else {
+		std::snprintf(buffer, sizeof(buffer), "%.1100Le", x);
+	}
+	std::string str = buffer;
+	auto const exponent_pos = str.find('e');
+	auto const last_nonzero = str.find_last_not_of('0', exponent_pos - 1);
+	auto const mantissa_end = str[last_nonzero] == '.' ? last_nonzero : last_nonzero + 1;
+	return str.substr(0, mantissa_end) + str.substr(exponent_pos);
+}
+
+// Perturbs the exact decimal representation str slightly upward or downward in magnitude.
+static std::string perturb(std::string str, bool upward)
+{
+	auto const exponent_pos = str.find('e');
+	if (str.find('.') == std::string::npos) {
+		str.insert(exponent_pos, ".");
+	}
+	auto pos = str.find('e') - 1;
+	if (upward) {
+		str.insert(pos + 1, "1");
+	}
+	else {
+		// Find the last nonzero digit.
+		while (pos != 0 && (str[pos] == '0' || str[pos] == '.')) {
+			--pos;
+		}
+		if (str[pos] < '1' || str[pos] > '9') {
+			return str;
+		}
+		--str[pos];
+		str.insert(str.find('e'), "9");
+	}
+	return str;
+}
+
+static int significant_digits(std::string const& str)
+{
+	int digits = 0;
+	bool leading = true;
+	for (auto c : str.substr(0, str.find('e'))) {
+		if (c >= '1' && c <= '9') {
+			leading = false;
+		}
+		if (!leading && c >= '0' && c <= '9') {
+			++digits;
+		}
+	}
+	return digits;
+}
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	using wide = wider_float<Float>;
+	constexpr auto digit_limit =
+		jkj::fp::to_binary_limited_precision_digit_limit<jkj::fp::ieee754_traits<Float>::format>;
+	static_assert(std::numeric_limits<wide>::digits >= std::numeric_limits<Float>::digits + 1,
+		"the middle points should be representable");
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<int> precision_dist{ 0, 40 };
+
+	bool success = true;
+	std::string str;
+
+	auto check = [&](char const* policy_name, ieee754_bits expected, auto... policies) {
+		auto const computed = jkj::fp::from_chars_unlimited<Float>(
+			str.data(), str.data() + str.size(), policies...);
+		if (computed.u != expected.u) {
+			std::cout << "Error detected! [policy = " << policy_name << ", input = " << str
+				<< ", expected = " << expected.u << ", computed = " << computed.u << "]\n";
+			success = false;
+		}
+		if (significant_digits(str) <= digit_limit) {
+			auto const computed_limited = jkj::fp::from_chars_limited<Float>(
+				str.data(), str.data() + str.size(), policies...);
+			if (computed_limited.u != expected.u) {
+				std::cout << "Error detected! [policy = " << policy_name << ", input = " << str
+					<< ", expected = " << expected.u
+					<< ", computed (limited) = " << computed_limited.u << "]\n";
+				success = false;
+			}
+		}
+	};
+
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+		auto next = ieee754_bits{ x };
+		++next.u;
+		if (!next.is_finite()) {
+			continue;
+		}
+		auto const middle = (wide(x) + wide(next.to_float())) / 2;
+
+		// Generate inputs close to a rounding boundary of some rounding mode.
+		std::string inputs[6];
+		char buffer[64];
+		inputs[0] = std::string(buffer,
+			jkj::fp::to_chars_fixed_precision_scientific_n(x, buffer, precision_dist(rg)));
+		inputs[1] = print_exactly<Float>(wide(x));
+		inputs[2] = print_exactly<Float>(middle);
+		inputs[3] = perturb(inputs[1], rg() % 2 == 0);
+		inputs[4] = perturb(inputs[2], true);
+		inputs[5] = perturb(inputs[2], false);
+
+		for (auto const& input : inputs) {
+			str = input;
+
+			// Reference results.
+			auto const nearest = strtof_with_rounding<Float>(str, FE_TONEAREST);
+			auto const upward = strtof_with_rounding<Float>(str, FE_UPWARD);
+			auto const downward = strtof_with_rounding<Float>(str, FE_DOWNWARD);
+			auto const toward_zero = strtof_with_rounding<Float>(str, FE_TOWARDZERO);
+			auto const is_negative = str[0] == '-';
+			auto const away_from_zero = is_negative ? downward : upward;
+
+			// Determine if the input is exactly a middle point, using the wider type.
+			std::fesetround(FE_UPWARD);
+			auto const wide_upward = std::strtold(str.c_str(), nullptr);
+			std::fesetround(FE_DOWNWARD);
+			auto const wide_downward = std::strtold(str.c_str(), nullptr);
+			std::fesetround(FE_TONEAREST);
+			bool const is_tie = wide_upward == wide_downward && toward_zero.u != away_from_zero.u &&
+				wide_upward == (wide(toward_zero.to_float()) + wide(away_from_zero.to_float())) / 2;
+
+			auto tie_or = [&](ieee754_bits tie_result) {
+				return is_tie ? tie_result : nearest;
+			};
+			auto const odd = toward_zero.u % 2 != 0 ? toward_zero : away_from_zero;
+
+			namespace br = jkj::fp::policy::binary_rounding;
+			check("nearest_to_even", nearest);
+			check("nearest_to_even", nearest, br::nearest_to_even);
+			check("nearest_to_odd", tie_or(odd), br::nearest_to_odd);
+			check("nearest_toward_plus_infinity",
+				tie_or(is_negative ? toward_zero : away_from_zero),
+				br::nearest_toward_plus_infinity);
+			check("nearest_toward_minus_infinity",
+				tie_or(is_negative ? away_from_zero : toward_zero),
+				br::nearest_toward_minus_infinity);
+			check("nearest_toward_zero", tie_or(toward_zero), br::nearest_toward_zero);
+			check("nearest_away_from_zero", tie_or(away_from_zero), br::nearest_away_from_zero);
+			check("nearest_to_even_static_boundary", nearest, br::nearest_to_even_static_boundary);
+			check("nearest_to_odd_static_boundary", tie_or(odd),
+				br::nearest_to_odd_static_boundary);
+			check("nearest_toward_plus_infinity_static_boundary",
+				tie_or(is_negative ? toward_zero : away_from_zero),
+				br::nearest_toward_plus_infinity_static_boundary);
+			check("nearest_toward_minus_infinity_static_boundary",
+				tie_or(is_negative ? away_from_zero : toward_zero),
+				br::nearest_toward_minus_infinity_static_boundary);
+			check("toward_plus_infinity", upward, br::toward_plus_infinity);
+			check("toward_minus_infinity", downward, br::toward_minus_infinity);
+			check("toward_zero", toward_zero, br::toward_zero);
+			check("away_from_zero", away_from_zero, br::away_from_zero);
+
+			check("cache::compact", nearest, jkj::fp::policy::cache::compact);
+			check("cache::compact, toward_zero", toward_zero,
+				jkj::fp::policy::cache::compact, br::toward_zero);
+
+			// sign::ignore parses the magnitude.
+			auto magnitude = is_negative ? strtof_with_rounding<Float>(str.substr(1), FE_UPWARD) :
+				upward;
+			check("sign::ignore, toward_plus_infinity", magnitude,
+				jkj::fp::policy::sign::ignore, br::toward_plus_infinity);
+		}
+	}
+
+	if (success) {
+		std::cout << "Rounding policy random test for " << type_name_string
+			<< " with " << number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 100000;
+
+	bool success = true;
+
+	std::cout << "[Testing from_chars with policies...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
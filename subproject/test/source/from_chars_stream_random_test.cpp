@@ -0,0 +1,250 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/from_chars/from_chars_stream.h"
+#include "jkj/fp/to_chars/fixed_precision.h"
+#include "jkj/fp/ryu_printf.h"
+#include "random_float.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Prints x with the given precision, with the decimal dot moved to a random position.
+template <class Float>
+static std::string print_random_token(Float x, int precision, std::mt19937_64& rg)
+{
+	char buffer[1024];
+	auto const last = jkj::fp::to_chars_fixed_precision_scientific_n(x, buffer, precision);
+
+	std::string digits;
+	char* ptr = buffer;
+	if (*ptr == '-') {
+		++ptr;
+	}
+	for (; *ptr != 'e'; ++ptr) {
+		if (*ptr != '.') {
+			digits += *ptr;
+		}
+	}
+	auto const dot_pos = std::uniform_int_distribution<int>{ 0, int(digits.size()) }(rg);
+	auto const exponent = std::atoi(std::string(ptr + 1, last).c_str()) + 1 - dot_pos;
+
+	std::string result = buffer[0] == '-' ? "-" : "";
+	result.append(digits, 0, std::size_t(dot_pos));
+	result += '.';
+	result.append(digits, std::size_t(dot_pos), std::string::npos);
+	result += 'e';
+	result += std::to_string(exponent);
+	return result;
+}
+
+// Prints the middle point between x and its successor, optionally followed by
+// many zeros and a one.
+template <class Float>
+static std::string print_middle_point(Float x, bool perturb)
+{
+	using jkj::fp::ryu_printf;
+	ryu_printf<Float> digit_gen{ jkj::fp::ieee754_bits<Float>{ x }, std::bool_constant<true>{} };
+
+	std::string str;
+	char segment[ryu_printf<Float>::segment_size + 1];
+	int last_segment_index;
+	do {
+		std::snprintf(segment, sizeof(segment), "%09u", unsigned(digit_gen.current_segment()));
+		str += segment;
+		last_segment_index = digit_gen.current_segment_index();
+	} while (digit_gen.compute_next_segment());
+	int exponent = -last_segment_index * ryu_printf<Float>::segment_size;
+
+	str.erase(0, str.find_first_not_of('0'));
+	if (perturb) {
+		constexpr std::size_t number_of_zeros = 1000;
+		str.append(number_of_zeros, '0');
+		str += '1';
+		exponent -= int(number_of_zeros + 1);
+	}
+
+	return (std::signbit(x) ? "-" : "") + str + 'e' + std::to_string(exponent);
+}
+
+template <class Float, class TypenameString>
+bool test(std::size_t number_of_samples, int max_chunk_size, TypenameString&& type_name_string)
+{
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<int> kind_dist{ 0, 9 };
+	std::uniform_int_distribution<int> precision_dist{ 0, 40 };
+	std::uniform_int_distribution<int> chunk_size_dist{ 1, max_chunk_size };
+	char const separators[] = { ' ', ',', ';', '\n', '\t' };
+	std::uniform_int_distribution<std::size_t> separator_dist{ 0, sizeof(separators) - 1 };
+
+	// Generate the input stream.
+	std::string stream;
+	std::vector<std::pair<std::size_t, std::size_t>> tokens;
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+		auto const kind = kind_dist(rg);
+		auto const token = kind == 0 ? print_middle_point(x, false) :
+			kind == 1 ? print_middle_point(x, true) :
+			print_random_token(x, precision_dist(rg), rg);
+
+		tokens.emplace_back(stream.size(), stream.size() + token.size());
+		stream += token;
+		stream += separators[separator_dist(rg)];
+	}
+
+	// Feed the stream in random chunks.
+	std::vector<jkj::fp::ieee754_bits<Float>> results;
+	jkj::fp::from_chars_stream<Float> parser;
+	for (std::size_t pos = 0; pos < stream.size();) {
+		auto chunk_size = std::size_t(chunk_size_dist(rg));
+		if (chunk_size > stream.size() - pos) {
+			chunk_size = stream.size() - pos;
+		}
+		parser.feed(stream.data() + pos, stream.data() + pos + chunk_size,
+			std::back_inserter(results));
+		pos += chunk_size;
+	}
+	parser.finish(std::back_inserter(results));
+
+	if (results.size() != tokens.size()) {
+		std::cout << "Error detected! [expected " << tokens.size()
+			<< " numbers, but got " << results.size() << "]\n";
+		return false;
+	}
+
+	bool success = true;
+	for (std::size_t i = 0; i < tokens.size(); ++i) {
+		auto const expected = jkj::fp::from_chars_unlimited<Float>(
+			stream.data() + tokens[i].first, stream.data() + tokens[i].second);
+		if (expected.u != results[i].u) {
+			std::cout << "Error detected! [input = "
+				<< stream.substr(tokens[i].first, tokens[i].second - tokens[i].first)
+				<< ", expected = " << expected.u << ", computed = " << results[i].u << "]\n";
+			success = false;
+		}
+	}
+
+	if (success) {
+		std::cout << "Chunked stream random test for " << type_name_string
+			<< " with " << number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+// Splits the same input at every offset, and also feeds it one character at a time.
+// The results should always be the same as feeding the whole input at once.
+// Some tokens are followed by characters that cannot continue the number, which should
+// be ignored up to the end of the token.
+template <class Float, class TypenameString>
+bool test_every_split(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using results_t = std::vector<jkj::fp::ieee754_bits<Float>>;
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<int> precision_dist{ 0, 20 };
+
+	// Pairs of a token and the number it should yield.
+	std::vector<std::pair<std::string, std::string>> tokens = {
+		{ "2024-01-05", "2024" }, { "1.2.3", "1.2" }, { "12e3e4", "12e3" },
+		{ "-7+8", "-7" }, { "0.5e-2-", "0.5e-2" }, { "+0.0001e+1.5", "+0.0001e+1" }
+	};
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+		auto const token = print_random_token(x, precision_dist(rg), rg);
+		tokens.emplace_back(token, token);
+	}
+
+	std::string stream;
+	results_t expected;
+	for (auto const& token : tokens) {
+		stream += token.first;
+		stream += ", ";
+		expected.push_back(jkj::fp::from_chars_unlimited<Float>(
+			token.second.data(), token.second.data() + token.second.size()));
+	}
+	auto const first = stream.data();
+	auto const last = first + stream.size();
+
+	auto check = [&](results_t const& results, char const* description) {
+		bool success = results.size() == expected.size();
+		for (std::size_t i = 0; success && i < results.size(); ++i) {
+			success = results[i].u == expected[i].u;
+		}
+		if (!success) {
+			std::cout << "Error detected! [" << description << "]\n";
+		}
+		return success;
+	};
+
+	bool success = true;
+	for (std::size_t pos = 0; pos <= stream.size(); ++pos) {
+		results_t results;
+		jkj::fp::from_chars_stream<Float> parser;
+		parser.feed(first, first + pos, std::back_inserter(results));
+		parser.feed(first + pos, last, std::back_inserter(results));
+		parser.finish(std::back_inserter(results));
+		if (!check(results, ("split at " + std::to_string(pos)).c_str())) {
+			success = false;
+			break;
+		}
+	}
+
+	results_t results;
+	jkj::fp::from_chars_stream<Float> parser;
+	for (auto ptr = first; ptr != last; ++ptr) {
+		parser.feed(ptr, ptr + 1, std::back_inserter(results));
+	}
+	parser.finish(std::back_inserter(results));
+	success &= check(results, "one character at a time");
+
+	if (success) {
+		std::cout << "Every-split test for " << type_name_string
+			<< " with " << tokens.size() << " tokens succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 100000;
+
+	bool success = true;
+
+	std::cout << "[Testing from_chars_stream with small chunks...]\n";
+	success &= test<float>(number_of_samples, 8, "binary32");
+	success &= test<double>(number_of_samples, 8, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	std::cout << "[Testing from_chars_stream with large chunks...]\n";
+	success &= test<float>(number_of_samples, 4096, "binary32");
+	success &= test<double>(number_of_samples, 4096, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	std::cout << "[Testing from_chars_stream split at every position...]\n";
+	success &= test_every_split<float>(200, "binary32");
+	success &= test_every_split<double>(200, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
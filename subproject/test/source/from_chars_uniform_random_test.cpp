@@ -0,0 +1,226 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/from_chars/from_chars.h"
+#include "jkj/fp/to_chars/fixed_precision.h"
+#include "jkj/fp/ryu_printf.h"
+#include "random_float.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Converts the output of to_chars_fixed_precision_scientific_n into a string
+// with the decimal dot placed after dot_pos digits, preceded by leading_zeros zeros.
+static std::string rearrange(char const* first, char const* last,
+	int dot_pos, int leading_zeros)
+{
+	std::string digits;
+	char const* ptr = first;
+	if (*ptr == '-') {
+		++ptr;
+	}
+	for (; *ptr != 'e'; ++ptr) {
+		if (*ptr != '.') {
+			digits += *ptr;
+		}
+	}
+	int exponent = std::atoi(std::string(ptr + 1, last).c_str());
+	exponent += 1 - dot_pos;
+
+	std::string result;
+	if (*first == '-') {
+		result += '-';
+	}
+	result.append(std::size_t(leading_zeros), '0');
+	result.append(digits, 0, std::size_t(dot_pos));
+	if (dot_pos != int(digits.size())) {
+		result += '.';
+		result.append(digits, std::size_t(dot_pos), std::string::npos);
+	}
+	if (exponent != 0) {
+		result += 'e';
+		result += std::to_string(exponent);
+	}
+	return result;
+}
+
+// Prints the middle point between x and its successor.
+// If digits is positive, only that many significant digits are printed, and then
+// the last printed digit is increased by one if round_up is true.
+template <class Float>
+static std::string print_near_halfway(Float x, int digits, bool round_up)
+{
+	using jkj::fp::ryu_printf;
+	ryu_printf<Float> digit_gen{ jkj::fp::ieee754_bits<Float>{ x }, std::bool_constant<true>{} };
+
+	std::string str;
+	char segment[ryu_printf<Float>::segment_size + 1];
+	int last_segment_index;
+	do {
+		std::snprintf(segment, sizeof(segment), "%09u", unsigned(digit_gen.current_segment()));
+		str += segment;
+		last_segment_index = digit_gen.current_segment_index();
+	} while (digit_gen.compute_next_segment());
+	int exponent = -last_segment_index * ryu_printf<Float>::segment_size;
+
+	str.erase(0, str.find_first_not_of('0'));
+	if (digits > 0 && int(str.size()) > digits) {
+		exponent += int(str.size()) - digits;
+		str.resize(std::size_t(digits));
+
+		if (round_up) {
+			auto pos = str.size() - 1;
+			for (; str[pos] == '9'; --pos) {
+				str[pos] = '0';
+				if (pos == 0) {
+					str.insert(str.begin(), '0');
+					++pos;
+				}
+			}
+			++str[pos];
+		}
+	}
+
+	return (std::signbit(x) ? "-" : "") + str + 'e' + std::to_string(exponent);
+}
+
+template <class Float>
+static Float reference_parse(std::string const& str) {
+	if constexpr (std::is_same_v<Float, float>) {
+		return std::strtof(str.c_str(), nullptr);
+	}
+	else {
+		return std::strtod(str.c_str(), nullptr);
+	}
+}
+
+template <class Float, class Parser, class TypenameString>
+bool test(std::size_t number_of_samples, int max_digits, bool allow_leading_zeros,
+	Parser&& parser, TypenameString&& type_name_string)
+{
+	char buffer[1024];
+	bool success = true;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	for (int digits = 1; digits <= max_digits; ++digits) {
+		std::uniform_int_distribution<int> dot_pos_dist{ 0, digits };
+		std::uniform_int_distribution<int> leading_zeros_dist{ 0, allow_leading_zeros ? 3 : 0 };
+
+		for (std::size_t i = 0; i < number_of_samples; ++i) {
+			auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+			auto const last = jkj::fp::to_chars_fixed_precision_scientific_n(x, buffer, digits - 1);
+			auto const str = rearrange(buffer, last, dot_pos_dist(rg), leading_zeros_dist(rg));
+
+			auto const expected = jkj::fp::ieee754_bits<Float>{ reference_parse<Float>(str) };
+			auto const computed = parser(str.data(), str.data() + str.size());
+
+			if (expected.u != computed.u) {
+				std::cout << "Error detected! [input = " << str
+					<< ", expected = " << expected.u << ", computed = " << computed.u << "]\n";
+				success = false;
+			}
+		}
+	}
+
+	if (success) {
+		std::cout << "Uniform random test for " << type_name_string << " with "
+			<< number_of_samples << " examples per digit count succeeded.\n";
+	}
+
+	return success;
+}
+
+template <class Float, class Parser, class TypenameString>
+bool test_near_halfway(std::size_t number_of_samples, int max_digits,
+	Parser&& parser, TypenameString&& type_name_string)
+{
+	bool success = true;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<int> digits_dist{ 0, max_digits };
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+		auto const digits = digits_dist(rg);
+
+		for (bool round_up : { false, true }) {
+			auto const str = print_near_halfway(x, digits, round_up);
+
+			auto const expected = jkj::fp::ieee754_bits<Float>{ reference_parse<Float>(str) };
+			auto const computed = parser(str.data(), str.data() + str.size());
+
+			if (expected.u != computed.u) {
+				std::cout << "Error detected! [input = " << str
+					<< ", expected = " << expected.u << ", computed = " << computed.u << "]\n";
+				success = false;
+			}
+		}
+	}
+
+	if (success) {
+		std::cout << "Near-halfway random test for " << type_name_string << " with "
+			<< number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 100000;
+	constexpr int max_digits_unlimited = 40;
+
+	bool success = true;
+
+	std::cout << "[Testing from_chars_limited with uniformly randomly generated inputs...]\n";
+	success &= test<float>(number_of_samples,
+		jkj::fp::to_binary_limited_precision_digit_limit<jkj::fp::ieee754_format::binary32>,
+		false, [](char const* first, char const* last) {
+			return jkj::fp::from_chars_limited<float>(first, last);
+		}, "binary32");
+	success &= test<double>(number_of_samples,
+		jkj::fp::to_binary_limited_precision_digit_limit<jkj::fp::ieee754_format::binary64>,
+		false, [](char const* first, char const* last) {
+			return jkj::fp::from_chars_limited<double>(first, last);
+		}, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	std::cout << "[Testing from_chars_unlimited with uniformly randomly generated inputs...]\n";
+	success &= test<float>(number_of_samples / 10, max_digits_unlimited, true,
+		[](char const* first, char const* last) {
+			return jkj::fp::from_chars_unlimited<float>(first, last);
+		}, "binary32");
+	success &= test<double>(number_of_samples / 10, max_digits_unlimited, true,
+		[](char const* first, char const* last) {
+			return jkj::fp::from_chars_unlimited<double>(first, last);
+		}, "binary64");
+	success &= test_near_halfway<float>(number_of_samples, max_digits_unlimited,
+		[](char const* first, char const* last) {
+			return jkj::fp::from_chars_unlimited<float>(first, last);
+		}, "binary32");
+	success &= test_near_halfway<double>(number_of_samples, max_digits_unlimited,
+		[](char const* first, char const* last) {
+			return jkj::fp::from_chars_unlimited<double>(first, last);
+		}, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
@@ -0,0 +1,229 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/to_chars/hexadecimal.h"
+#include "jkj/fp/from_chars/from_chars_hex.h"
+#include "random_float.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// Generates a hexadecimal string with many digits, so that it is rarely exactly representable.
+template <class Float>
+static std::string generate_random_hex_string(std::mt19937_64& rg)
+{
+	using format_info = jkj::fp::ieee754_format_info<jkj::fp::ieee754_traits<Float>::format>;
+	constexpr char hex_digits[] = "0123456789abcdefABCDEF";
+	std::uniform_int_distribution<int> digit_dist{ 0, 21 };
+	std::uniform_int_distribution<int> length_dist{ 1, 40 };
+	std::uniform_int_distribution<int> exponent_dist{
+		format_info::min_exponent - format_info::significand_bits - 200,
+		format_info::max_exponent + 40 };
+
+	std::string str = rg() % 2 == 0 ? "0x" : "-0X";
+	auto const length = length_dist(rg);
+	auto const dot_pos = std::uniform_int_distribution<int>{ 0, length }(rg);
+	for (int i = 0; i < length; ++i) {
+		if (i == dot_pos) {
+			str += '.';
+		}
+		// Generate a lot of zeros and f's to exercise rounding boundaries.
+		switch (rg() % 4) {
+		case 0:
+			str += '0';
+			break;
+		case 1:
+			str += 'f';
+			break;
+		default:
+			str += hex_digits[digit_dist(rg)];
+		}
+	}
+	str += 'p';
+	str += std::to_string(exponent_dist(rg));
+	return str;
+}
+
+// Straightforward correctly rounded conversion of the output of generate_random_hex_string.
+template <class Float>
+static jkj::fp::ieee754_bits<Float> reference_parse(std::string const& str)
+{
+	using format_info = jkj::fp::ieee754_format_info<jkj::fp::ieee754_traits<Float>::format>;
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	using carrier_uint = typename ieee754_bits::carrier_uint;
+	constexpr int significand_bits = format_info::significand_bits;
+
+	// Collect all the bits of the significand; its value is bits * 2^exponent.
+	std::size_t pos = str[0] == '-' ? 3 : 2;
+	std::string bits;
+	int exponent = 0;
+	for (; str[pos] != 'p'; ++pos) {
+		if (str[pos] == '.') {
+			continue;
+		}
+		auto const value = jkj::fp::detail::hex::digit_value(str[pos]);
+		for (int i = 3; i >= 0; --i) {
+			bits += char('0' + ((value >> i) & 1));
+		}
+		if (str.find('.') < pos) {
+			exponent -= 4;
+		}
+	}
+	exponent += std::atoi(str.c_str() + pos + 1);
+
+	carrier_uint result = str[0] == '-' ? ieee754_bits::negative_zero() : 0;
+	bits.erase(0, bits.find_first_not_of('0'));
+	if (bits.empty()) {
+		return ieee754_bits{ result };
+	}
+
+	// Exponents of the most significant bit and the least significant retained bit.
+	auto const msb_exponent = exponent + int(bits.size()) - 1;
+	auto lsb_exponent = std::max(msb_exponent, format_info::min_exponent) - significand_bits;
+	auto const kept_bits = msb_exponent - lsb_exponent + 1;
+
+	std::uint64_t rounded = 0;
+	for (int i = 0; i < kept_bits; ++i) {
+		rounded = rounded * 2 + (i < int(bits.size()) && bits[std::size_t(i)] == '1');
+	}
+	if (kept_bits >= 0 && kept_bits < int(bits.size()) && bits[std::size_t(kept_bits)] == '1') {
+		auto const has_sticky_bits =
+			bits.find('1', std::size_t(kept_bits) + 1) != std::string::npos;
+		if (has_sticky_bits || rounded % 2 != 0) {
+			++rounded;
+		}
+	}
+	if (rounded == (std::uint64_t(2) << significand_bits)) {
+		rounded /= 2;
+		++lsb_exponent;
+	}
+
+	if (rounded < (std::uint64_t(1) << significand_bits)) {
+		result |= carrier_uint(rounded);
+	}
+	else if (lsb_exponent + significand_bits > format_info::max_exponent) {
+		result |= ieee754_bits::positive_infinity();
+	}
+	else {
+		auto const exponent_field = lsb_exponent + significand_bits - format_info::exponent_bias;
+		result |= carrier_uint((carrier_uint(exponent_field) << significand_bits)
+			| carrier_uint(rounded - (std::uint64_t(1) << significand_bits)));
+	}
+	return ieee754_bits{ result };
+}
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<int> precision_dist{ 0, 16 };
+
+	bool success = true;
+	char buffer[64];
+	char buffer2[64];
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto const x = jkj::fp::detail::uniformly_randomly_generate_general_float<Float>(rg);
+
+		// Shortest form; printf converts float into double, so compare only for double.
+		auto last = jkj::fp::to_chars_hex_n(x, buffer);
+		if constexpr (std::is_same_v<Float, double>) {
+			auto const length = std::snprintf(buffer2, sizeof(buffer2), "%a", x);
+			if (std::string_view(buffer, std::size_t(last - buffer)) !=
+				std::string_view(buffer2, std::size_t(length)))
+			{
+				std::cout << "Error detected! [printf = " << buffer2 << ", computed = "
+					<< std::string_view(buffer, std::size_t(last - buffer)) << "]\n";
+				success = false;
+			}
+		}
+
+		// Round trip.
+		auto const parsed = jkj::fp::from_chars_hex<Float>(buffer, last);
+		if (ieee754_bits(x).is_nan() ? !parsed.is_nan() : parsed.u != ieee754_bits(x).u) {
+			std::cout << "Error detected! [input = "
+				<< std::string_view(buffer, std::size_t(last - buffer))
+				<< ", expected = " << ieee754_bits(x).u << ", parsed = " << parsed.u << "]\n";
+			success = false;
+		}
+
+		// Fixed precision; glibc also rounds to nearest, ties to even.
+		if constexpr (std::is_same_v<Float, double>) {
+			if (!ieee754_bits(x).is_nan()) {
+				auto const precision = precision_dist(rg);
+				last = jkj::fp::to_chars_hex_n(x, buffer, precision);
+				auto const length = std::snprintf(buffer2, sizeof(buffer2), "%.*a", precision, x);
+				if (std::string_view(buffer, std::size_t(last - buffer)) !=
+					std::string_view(buffer2, std::size_t(length)))
+				{
+					std::cout << "Error detected! [precision = " << precision << ", printf = "
+						<< buffer2 << ", computed = "
+						<< std::string_view(buffer, std::size_t(last - buffer)) << "]\n";
+					success = false;
+				}
+			}
+		}
+
+		// Parsing with rounding.
+		// Some versions of glibc do not round subnormal results correctly,
+		// so strtod is used only for normal results.
+		auto const str = generate_random_hex_string<Float>(rg);
+		auto const expected = reference_parse<Float>(str);
+		auto const computed = jkj::fp::from_chars_hex<Float>(str.data(), str.data() + str.size());
+		if (expected.u != computed.u) {
+			std::cout << "Error detected! [input = " << str << ", expected = " << expected.u
+				<< ", computed = " << computed.u << "]\n";
+			success = false;
+		}
+		if (!expected.is_subnormal()) {
+			auto const from_strtod = ieee754_bits(std::is_same_v<Float, float> ?
+				Float(std::strtof(str.c_str(), nullptr)) : Float(std::strtod(str.c_str(), nullptr)));
+			if (from_strtod.u != computed.u) {
+				std::cout << "Error detected! [input = " << str << ", strtod = " << from_strtod.u
+					<< ", computed = " << computed.u << "]\n";
+				success = false;
+			}
+		}
+	}
+
+	if (success) {
+		std::cout << "Hexadecimal formatting and parsing random test for " << type_name_string
+			<< " with " << number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 1000000;
+
+	bool success = true;
+
+	std::cout << "[Testing hexadecimal formatting and parsing...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
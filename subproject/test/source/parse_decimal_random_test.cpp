@@ -0,0 +1,135 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+// (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/from_chars/from_chars.h"
+#include "random_float.h"
+#include <iostream>
+#include <limits>
+#include <string>
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using carrier_uint = typename jkj::fp::ieee754_traits<Float>::carrier_uint;
+	constexpr auto max_digits = std::size_t(std::numeric_limits<carrier_uint>::digits10);
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<int> length_dist{ 0, 30 };
+	std::uniform_int_distribution<int> exponent_dist{ -1000, 1000 };
+	char const suffixes[][3] = { "", ",", "e", "e+", "x" };
+
+	auto random_digits = [&](int count) {
+		std::string str;
+		for (int i = 0; i < count; ++i) {
+			// Lots of zeros to produce leading and trailing zeros.
+			str += rg() % 2 == 0 ? '0' : char('0' + rg() % 10);
+		}
+		return str;
+	};
+
+	bool success = true;
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto integer_part = random_digits(length_dist(rg));
+		auto const fractional_part = random_digits(length_dist(rg));
+		if (integer_part.empty() && fractional_part.empty()) {
+			integer_part = "0";
+		}
+		auto const exponent = rg() % 2 == 0 ? 0 : exponent_dist(rg);
+
+		std::string number = rg() % 2 == 0 ? "" : "-";
+		number += integer_part;
+		if (!fractional_part.empty() || rg() % 2 == 0) {
+			number += '.';
+			number += fractional_part;
+		}
+		if (exponent != 0) {
+			number += 'e';
+			number += std::to_string(exponent);
+		}
+		auto const input = number + suffixes[rg() % (sizeof(suffixes) / sizeof(suffixes[0]))];
+
+		// Compute the expected result from the string of significant digits.
+		auto significant_digits = integer_part + fractional_part;
+		significant_digits.erase(0, significant_digits.find_first_not_of('0'));
+		auto const kept_digits = significant_digits.substr(0, max_digits);
+		auto const dropped_digits = significant_digits.substr(kept_digits.size());
+
+		carrier_uint expected_significand = 0;
+		for (auto c : kept_digits) {
+			expected_significand = expected_significand * 10 + carrier_uint(c - '0');
+		}
+		auto const expected_exponent = exponent - int(fractional_part.size())
+			+ int(dropped_digits.size());
+
+		auto const computed =
+			jkj::fp::parse_decimal<Float>(input.data(), input.data() + input.size());
+		if (computed.decimal.significand != expected_significand ||
+			computed.decimal.exponent != expected_exponent ||
+			computed.decimal.is_negative != (number[0] == '-') ||
+			computed.digits != int(significant_digits.size()) ||
+			computed.is_truncated != !dropped_digits.empty() ||
+			computed.has_nonzero_tail !=
+			(dropped_digits.find_first_not_of('0') != std::string::npos) ||
+			computed.has_exponent_overflow ||
+			computed.ptr != input.data() + number.size())
+		{
+			std::cout << "Error detected! [input = " << input
+				<< ", significand = " << computed.decimal.significand
+				<< ", exponent = " << computed.decimal.exponent
+				<< ", digits = " << computed.digits
+				<< ", truncated = " << computed.is_truncated
+				<< ", nonzero tail = " << computed.has_nonzero_tail
+				<< ", length = " << (computed.ptr - input.data()) << "]\n";
+			success = false;
+		}
+	}
+
+	// Exponent overflow.
+	std::string const huge_exponent = "1.5e-99999999999";
+	auto const computed = jkj::fp::parse_decimal<Float>(huge_exponent.data(),
+		huge_exponent.data() + huge_exponent.size());
+	if (!computed.has_exponent_overflow || computed.decimal.exponent >= -(1 << 26) ||
+		computed.ptr != huge_exponent.data() + huge_exponent.size())
+	{
+		std::cout << "Error detected! [input = " << huge_exponent
+			<< ", exponent = " << computed.decimal.exponent << "]\n";
+		success = false;
+	}
+
+	if (success) {
+		std::cout << "Decimal parsing random test for " << type_name_string
+			<< " with " << number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 1000000;
+
+	bool success = true;
+
+	std::cout << "[Testing parse_decimal...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
@@ -0,0 +1,276 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/scaled_decimal.h"
+#include "random_float.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Rounds the exact decimal expansion of x at 10^exponent.
+template <class Float, class DecimalRoundingPolicy>
+static jkj::fp::scaled_decimal_result reference_implementation(Float x, int exponent)
+{
+	using tag_t = jkj::fp::detail::policy::decimal_rounding::tag_t;
+
+	static char buffer[2048];
+	std::snprintf(buffer, sizeof(buffer), "%.1100f", double(x));
+	std::string str = buffer;
+	bool const is_negative = str[0] == '-';
+	if (is_negative) {
+		str.erase(0, 1);
+	}
+	auto const dot_pos = str.find('.');
+	auto const digits = str.substr(0, dot_pos) + str.substr(dot_pos + 1);
+	auto const kept_length = int(dot_pos) - exponent;
+
+	unsigned __int128 magnitude = 0;
+	bool overflow = false;
+	for (int i = 0; i < kept_length && i < int(digits.size()); ++i) {
+		magnitude = magnitude * 10 + unsigned(digits[i] - '0');
+		if (magnitude > (unsigned __int128)(std::numeric_limits<std::uint64_t>::max())) {
+			overflow = true;
+			break;
+		}
+	}
+	for (int i = int(digits.size()); i < kept_length && !overflow; ++i) {
+		magnitude *= 10;
+		overflow = magnitude > (unsigned __int128)(std::numeric_limits<std::uint64_t>::max());
+	}
+
+	auto const rest = kept_length < 0 ? std::string(std::size_t(-kept_length), '0') + digits :
+		kept_length < int(digits.size()) ? digits.substr(std::size_t(kept_length)) : std::string{};
+	bool const is_half_or_above = !rest.empty() && rest[0] >= '5';
+	bool const has_more = !rest.empty() && rest.find_first_not_of('0', 1) != std::string::npos;
+	bool const is_half = !rest.empty() && rest[0] == '5' && !has_more;
+
+	bool round_up = is_half_or_above;
+	if (is_half) {
+		switch (DecimalRoundingPolicy::tag) {
+		case tag_t::to_even:
+			round_up = magnitude % 2 != 0;
+			break;
+		case tag_t::to_odd:
+			round_up = magnitude % 2 == 0;
+			break;
+		case tag_t::toward_zero:
+			round_up = false;
+			break;
+		default:
+			round_up = true;
+		}
+	}
+	magnitude += round_up ? 1 : 0;
+
+	auto const limit = (unsigned __int128)(std::uint64_t(1) << 63) - (is_negative ? 0 : 1);
+	if (overflow || magnitude > limit) {
+		return{ 0, true };
+	}
+	auto const value = std::uint64_t(magnitude);
+	return{ is_negative ? std::int64_t(std::uint64_t(0) - value) : std::int64_t(value), false };
+}
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<int> small_exponent_dist{ -30, 30 };
+	std::uniform_int_distribution<int> large_exponent_dist{ -400, 400 };
+	std::uniform_int_distribution<int> power_dist{ 0, 20 };
+
+	bool success = true;
+	Float x;
+	int exponent;
+
+	auto check = [&](char const* policy_name, auto policy) {
+		auto const expected = reference_implementation<Float, decltype(policy)>(x, exponent);
+		auto const computed = jkj::fp::to_scaled_decimal(x, exponent, policy);
+		if (expected.is_overflow != computed.is_overflow ||
+			(!expected.is_overflow && expected.value != computed.value))
+		{
+			char buffer[64];
+			std::snprintf(buffer, sizeof(buffer), "%.17g", double(x));
+			std::cout << "Error detected! [policy = " << policy_name << ", input = " << buffer
+				<< ", exponent = " << exponent << ", expected = " << expected.value
+				<< (expected.is_overflow ? " (overflow)" : "") << ", computed = "
+				<< computed.value << (computed.is_overflow ? " (overflow)" : "") << "]\n";
+			success = false;
+		}
+	};
+
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		switch (rg() % 3) {
+		case 0:
+			x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+			exponent = rg() % 2 == 0 ? small_exponent_dist(rg) : large_exponent_dist(rg);
+			break;
+		case 1:
+			// Values like 123.45 and their neighbors.
+			exponent = -power_dist(rg);
+			x = Float(std::int32_t(rg())) / Float(std::pow(10.0, -exponent));
+			exponent += int(rg() % 3) - 1;
+			break;
+		default:
+		{
+			auto const q = power_dist(rg);
+			auto const odd = Float((rg() % (1 << 20)) * 2 + 1);
+			if (rg() % 2 == 0) {
+				// Exact ties, odd * 2^-(q + 1) with exponent = -q.
+				x = odd / Float(std::pow(2.0, q + 1));
+				exponent = -q;
+			}
+			else {
+				// Exact ties, odd * 5 * 10^(q - 1) with exponent = q.
+				x = odd * Float(5 * std::pow(10.0, q - 1));
+				exponent = q;
+			}
+		}
+		}
+		if (rg() % 2 == 0) {
+			x = -x;
+		}
+
+		namespace dr = jkj::fp::policy::decimal_rounding;
+		check("to_even", dr::to_even);
+		check("to_odd", dr::to_odd);
+		check("away_from_zero", dr::away_from_zero);
+		check("toward_zero", dr::toward_zero);
+	}
+
+	if (success) {
+		std::cout << "Scaled decimal random test for " << type_name_string
+			<< " with " << number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+template <class Float>
+static Float parse(char const* str)
+{
+	if constexpr (std::is_same_v<Float, float>) {
+		return std::strtof(str, nullptr);
+	}
+	else {
+		return std::strtod(str, nullptr);
+	}
+}
+
+template <class Float, class TypenameString>
+static bool test_rounding(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<int> decimal_places_dist{ -5, 25 };
+	std::uniform_int_distribution<int> significant_digits_dist{ 1, 20 };
+	std::uniform_int_distribution<int> power_dist{ -10, 10 };
+
+	bool success = true;
+	std::vector<Float> inputs;
+	std::vector<Float> outputs;
+	char buffer[2048];
+
+	auto report = [&](char const* function_name, Float x, int n, Float expected, Float computed) {
+		if (jkj::fp::ieee754_bits<Float>{ expected }.u != jkj::fp::ieee754_bits<Float>{ computed }.u) {
+			std::snprintf(buffer, sizeof(buffer), "%.17g, n = %d, expected = %.17g, computed = %.17g",
+				double(x), n, double(expected), double(computed));
+			std::cout << "Error detected! [" << function_name << ", input = " << buffer << "]\n";
+			success = false;
+		}
+	};
+
+	std::size_t count = 0;
+	while (count < number_of_samples) {
+		inputs.resize(std::uniform_int_distribution<std::size_t>{ 0, 200 }(rg));
+		for (auto& x : inputs) {
+			if (rg() % 2 == 0) {
+				x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+			}
+			else {
+				// Numbers of moderate size, with a fractional part.
+				x = Float(double(std::int64_t(rg() >> 20)) / double(1 << 20)
+					* std::pow(10.0, power_dist(rg)));
+			}
+			if (rg() % 2 == 0) {
+				x = -x;
+			}
+		}
+		count += inputs.size();
+
+		// Reference results, computed by formatting with glibc and parsing back.
+		auto const decimal_places = decimal_places_dist(rg);
+		for (auto x : inputs) {
+			Float expected;
+			if (decimal_places >= 0) {
+				std::snprintf(buffer, sizeof(buffer), "%.*f", decimal_places, double(x));
+				expected = parse<Float>(buffer);
+			}
+			else {
+				auto const scaled = jkj::fp::to_scaled_decimal(x, -decimal_places);
+				std::snprintf(buffer, sizeof(buffer), "%s%llde%d", std::signbit(x) ? "-" : "",
+					std::llabs((long long)scaled.value), -decimal_places);
+				expected = scaled.is_overflow ? x : parse<Float>(buffer);
+			}
+			report("round_to_decimal_places", x, decimal_places, expected,
+				jkj::fp::round_to_decimal_places(x, decimal_places));
+		}
+
+		outputs.assign(inputs.size(), Float(0));
+		jkj::fp::round_to_decimal_places_batch(inputs.data(), inputs.data() + inputs.size(),
+			decimal_places, outputs.data());
+		for (std::size_t i = 0; i < inputs.size(); ++i) {
+			report("round_to_decimal_places_batch", inputs[i], decimal_places,
+				jkj::fp::round_to_decimal_places(inputs[i], decimal_places), outputs[i]);
+		}
+
+		auto const significant_digits = significant_digits_dist(rg);
+		for (auto x : inputs) {
+			std::snprintf(buffer, sizeof(buffer), "%.*e", significant_digits - 1, double(x));
+			report("round_to_significant", x, significant_digits, parse<Float>(buffer),
+				jkj::fp::round_to_significant(x, significant_digits));
+		}
+	}
+
+	if (success) {
+		std::cout << "Decimal rounding random test for " << type_name_string
+			<< " with " << count << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 200000;
+
+	bool success = true;
+
+	std::cout << "[Testing to_scaled_decimal and decimal rounding...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	success &= test_rounding<float>(number_of_samples, "binary32");
+	success &= test_rounding<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
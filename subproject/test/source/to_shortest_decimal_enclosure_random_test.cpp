@@ -0,0 +1,132 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/to_chars/shortest_roundtrip.h"
+#include "random_float.h"
+#include <cfenv>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+template <class Float>
+static Float strtof_with_rounding(std::string const& str, int mode)
+{
+	std::fesetround(mode);
+	Float result;
+	if constexpr (std::is_same_v<Float, float>) {
+		result = std::strtof(str.c_str(), nullptr);
+	}
+	else {
+		result = std::strtod(str.c_str(), nullptr);
+	}
+	std::fesetround(FE_TONEAREST);
+	return result;
+}
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	namespace br = jkj::fp::policy::binary_rounding;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+
+	bool success = true;
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		// Bounds that are close to each other or arbitrary.
+		auto lower = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+		auto upper_br = ieee754_bits{ lower };
+		if (rg() % 4 == 0) {
+			upper_br = ieee754_bits{
+				jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg) };
+		}
+		else {
+			upper_br.u += typename ieee754_bits::carrier_uint(rg() % 1000);
+			if (!upper_br.is_finite()) {
+				continue;
+			}
+		}
+		auto upper = upper_br.to_float();
+		if (upper < lower) {
+			std::swap(lower, upper);
+		}
+
+		auto const enclosure = jkj::fp::to_shortest_decimal_enclosure(lower, upper);
+
+		// Compare with the directed conversions of each bound.
+		auto const expected_lower = jkj::fp::to_shortest_decimal(lower, br::toward_plus_infinity);
+		auto const expected_upper = jkj::fp::to_shortest_decimal(upper, br::toward_minus_infinity);
+		if (enclosure.lower.significand != expected_lower.significand ||
+			enclosure.lower.exponent != expected_lower.exponent ||
+			enclosure.lower.is_negative != expected_lower.is_negative ||
+			enclosure.upper.significand != expected_upper.significand ||
+			enclosure.upper.exponent != expected_upper.exponent ||
+			enclosure.upper.is_negative != expected_upper.is_negative)
+		{
+			std::cout << "Error detected! [lower = " << ieee754_bits{ lower }.u
+				<< ", upper = " << ieee754_bits{ upper }.u << "]\n";
+			success = false;
+		}
+
+		// The printed bounds enclose [lower, upper] and read back to them.
+		char buffer[128];
+		auto const end = jkj::fp::to_chars_shortest_enclosure_n(lower, upper, buffer);
+		std::string const str(buffer, end);
+		auto const open_pos = str.find('[');
+		auto const comma_pos = str.find(',');
+		auto const close_pos = str.find(']');
+		auto const prefix = str.substr(0, open_pos);
+		auto const exponent_part = str.substr(close_pos + 1);
+		auto const lower_str = prefix + str.substr(open_pos + 1, comma_pos - open_pos - 1)
+			+ exponent_part;
+		auto const upper_str = prefix + str.substr(comma_pos + 1, close_pos - comma_pos - 1)
+			+ exponent_part;
+
+		if (strtof_with_rounding<Float>(lower_str, FE_UPWARD) != lower ||
+			strtof_with_rounding<Float>(lower_str, FE_DOWNWARD) > lower ||
+			strtof_with_rounding<Float>(upper_str, FE_DOWNWARD) != upper ||
+			strtof_with_rounding<Float>(upper_str, FE_UPWARD) < upper)
+		{
+			std::cout << "Error detected! [lower = " << ieee754_bits{ lower }.u
+				<< ", upper = " << ieee754_bits{ upper }.u << ", printed = " << str << "]\n";
+			success = false;
+		}
+	}
+
+	if (success) {
+		std::cout << "Shortest enclosure random test for " << type_name_string
+			<< " with " << number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 1000000;
+
+	bool success = true;
+
+	std::cout << "[Testing to_shortest_decimal_enclosure...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}
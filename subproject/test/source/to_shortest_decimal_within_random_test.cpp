@@ -0,0 +1,216 @@
+// Copyright 2020 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "jkj/fp/dragonbox.h"
+#include "random_float.h"
+#include <cfenv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+// A floating-point type that can represent the endpoints of the interval exactly.
+template <class Float>
+using wider_float = std::conditional_t<std::is_same_v<Float, float>, double, long double>;
+
+struct normalized_decimal {
+	std::uint64_t significand;
+	int exponent;
+
+	bool operator==(normalized_decimal const& other) const {
+		return significand == other.significand && exponent == other.exponent;
+	}
+};
+
+static normalized_decimal normalize(std::uint64_t significand, int exponent)
+{
+	if (significand == 0) {
+		return{ 0, 0 };
+	}
+	while (significand % 10 == 0) {
+		significand /= 10;
+		++exponent;
+	}
+	return{ significand, exponent };
+}
+
+// Finds the shortest decimal in [lower, upper] closest to x by trying each number of digits.
+template <class Float>
+static normalized_decimal reference_implementation(Float x, wider_float<Float> lower,
+	wider_float<Float> upper)
+{
+	char buffer[64];
+	for (int digits = 1; digits <= std::numeric_limits<Float>::max_digits10; ++digits) {
+		std::snprintf(buffer, sizeof(buffer), "%.*Le", digits - 1, (long double)(std::abs(x)));
+
+		std::fesetround(FE_UPWARD);
+		auto const upward = std::strtold(buffer, nullptr);
+		std::fesetround(FE_DOWNWARD);
+		auto const downward = std::strtold(buffer, nullptr);
+		std::fesetround(FE_TONEAREST);
+
+		if (upward <= upper && downward >= lower) {
+			std::string const str = buffer;
+			auto const exponent_pos = str.find('e');
+			std::uint64_t significand = 0;
+			for (std::size_t i = 0; i < exponent_pos; ++i) {
+				if (str[i] != '.') {
+					significand = significand * 10 + std::uint64_t(str[i] - '0');
+				}
+			}
+			return normalize(significand,
+				std::atoi(str.c_str() + exponent_pos + 1) - (digits - 1));
+		}
+	}
+	return normalize(0, 0);
+}
+
+template <class Float, class TypenameString>
+static bool test(std::size_t number_of_samples, TypenameString&& type_name_string)
+{
+	using ieee754_bits = jkj::fp::ieee754_bits<Float>;
+	using wide = wider_float<Float>;
+	constexpr auto significand_bits = jkj::fp::ieee754_format_info<
+		jkj::fp::ieee754_traits<Float>::format>::significand_bits;
+
+	auto rg = jkj::fp::detail::generate_correctly_seeded_mt19937_64();
+	std::uniform_int_distribution<int> scale_dist{ -4, significand_bits - 1 };
+	std::uniform_real_distribution<Float> factor_dist{ Float(0.5), Float(1) };
+
+	bool success = true;
+
+	auto check = [&](char const* name, Float x, Float tolerance, auto const& computed) {
+		// The interval the tolerance is rounded down to.
+		auto const br = ieee754_bits{ x };
+		auto const tolerance_br = ieee754_bits{ tolerance };
+		auto const half_ulp = std::ldexp(wide(1), br.binary_exponent() - significand_bits - 1);
+		auto const m = std::floor(wide(tolerance) / half_ulp);
+		auto const magnitude = std::abs(wide(x));
+		bool const is_zero = (tolerance_br.u << 1) >= (br.u << 1);
+
+		normalized_decimal expected;
+		if (is_zero) {
+			expected = normalize(0, 0);
+		}
+		else if (m == 1) {
+			auto const shortest = jkj::fp::to_shortest_decimal(x);
+			expected = normalize(shortest.significand, shortest.exponent);
+		}
+		else {
+			expected = reference_implementation(x, magnitude - m * half_ulp,
+				magnitude + m * half_ulp);
+		}
+
+		// The result should be in [|x| - m * half_ulp, |x| + m * half_ulp], which is exact.
+		auto const result = normalize(computed.significand, computed.exponent);
+		auto const str = std::to_string(result.significand) + "e" + std::to_string(result.exponent);
+		std::fesetround(FE_UPWARD);
+		auto const upward = std::strtold(str.c_str(), nullptr);
+		std::fesetround(FE_DOWNWARD);
+		auto const downward = std::strtold(str.c_str(), nullptr);
+		std::fesetround(FE_TONEAREST);
+		bool const in_band = is_zero ||
+			(upward <= (long double)(magnitude + m * half_ulp) &&
+				downward >= (long double)(magnitude - m * half_ulp));
+
+		if (!(result == expected) || !in_band || computed.is_negative != br.is_negative()) {
+			char buffer[64];
+			std::snprintf(buffer, sizeof(buffer), "%.*Le",
+				std::numeric_limits<Float>::max_digits10 - 1, (long double)(x));
+			std::cout << "Error detected! [" << name << ", x = " << buffer
+				<< ", tolerance = " << tolerance
+				<< ", expected = " << expected.significand << "e" << expected.exponent
+				<< ", computed = " << computed.significand << "e" << computed.exponent << "]\n";
+			success = false;
+		}
+	};
+
+	for (std::size_t i = 0; i < number_of_samples; ++i) {
+		auto const x = jkj::fp::detail::uniformly_randomly_generate_finite_float<Float>(rg);
+		auto const br = ieee754_bits{ x };
+		if (!br.is_nonzero()) {
+			continue;
+		}
+
+		// The tolerance should be at least half an ulp unless it is at least |x|.
+		auto const half_ulp = std::ldexp(wide(1), br.binary_exponent() - significand_bits - 1);
+		auto is_valid = [&](Float tolerance) {
+			return wide(tolerance) >= half_ulp || tolerance >= std::abs(x);
+		};
+
+		// Tolerances from about half an ulp to about 16 times |x|.
+		auto const scale = scale_dist(rg);
+		auto const tolerance = Float(std::ldexp(wide(factor_dist(rg)) * std::abs(wide(x)), -scale));
+		if (std::isfinite(tolerance) && is_valid(tolerance)) {
+			check("absolute", x, tolerance, jkj::fp::to_shortest_decimal_within(x, tolerance));
+		}
+
+		// Tolerances that are exact multiples of half an ulp.
+		auto const multiple = Float(wide(1 + rg() % 63) * half_ulp);
+		if (is_valid(multiple)) {
+			check("multiple of half ulp", x, multiple,
+				jkj::fp::to_shortest_decimal_within(x, multiple));
+		}
+
+		// The relative tolerance times |x|, rounded down. Some of them are powers of 2,
+		// so that the product is often exact.
+		auto const relative_tolerance = Float(std::ldexp(
+			rg() % 4 == 0 ? Float(1) : factor_dist(rg), -scale));
+		auto const product = Float(relative_tolerance * std::abs(x));
+		auto relative_br = ieee754_bits{ product };
+		if (std::fma(wide(relative_tolerance), std::abs(wide(x)), -wide(product)) < 0) {
+			--relative_br.u;
+		}
+		if (is_valid(relative_br.to_float())) {
+			check("relative", x, relative_br.to_float(),
+				jkj::fp::to_shortest_decimal_within_relative(x, relative_tolerance));
+		}
+	}
+
+	// An exact product is not decremented: 20 is on the boundary of [12, 20].
+	auto const exact = jkj::fp::to_shortest_decimal_within_relative(Float(16), Float(0.25));
+	if (!(normalize(exact.significand, exact.exponent) == normalize(2, 1))) {
+		std::cout << "Error detected! [relative, x = 16, relative_tolerance = 0.25, computed = "
+			<< exact.significand << "e" << exact.exponent << "]\n";
+		success = false;
+	}
+
+	if (success) {
+		std::cout << "Lossy shortest conversion random test for " << type_name_string
+			<< " with " << number_of_samples << " examples succeeded.\n";
+	}
+
+	return success;
+}
+
+int main()
+{
+	constexpr std::size_t number_of_samples = 100000;
+
+	bool success = true;
+
+	std::cout << "[Testing to_shortest_decimal_within...]\n";
+	success &= test<float>(number_of_samples, "binary32");
+	success &= test<double>(number_of_samples, "binary64");
+	std::cout << "Done.\n\n\n";
+
+	if (!success) {
+		return -1;
+	}
+}